@@ -0,0 +1,65 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+
+namespace bench {
+
+	/// Sink for benchmark results, prevents the optimizer from discarding measured work.
+	extern volatile std::size_t sink;
+
+	/// Number of calls to global operator new, maintained by allocation_counter.cpp.
+	extern std::atomic<std::size_t> allocations;
+
+	/// Number of bytes requested from global operator new, maintained by allocation_counter.cpp.
+	extern std::atomic<std::size_t> allocated_bytes;
+
+	/// Run measured function object for given number of iterations and report average cost per operation.
+	/**
+	Function object receives the iteration index and is expected to perform exactly one operation per call.
+	Reported are time, number of heap allocations and number of allocated bytes per operation.
+	*/
+	template<typename F>
+	void run(const char* name, const std::size_t iterations, F f) {
+		// Warm up caches and branch predictors before measuring.
+		for (std::size_t i = 0; i < iterations / 10 + 1; ++i) f(i);
+
+		const std::size_t allocs_before = allocations.load(std::memory_order_relaxed);
+		const std::size_t bytes_before = allocated_bytes.load(std::memory_order_relaxed);
+		auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < iterations; ++i) f(i);
+		auto end = std::chrono::steady_clock::now();
+		const std::size_t allocs = allocations.load(std::memory_order_relaxed) - allocs_before;
+		const std::size_t bytes = allocated_bytes.load(std::memory_order_relaxed) - bytes_before;
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count();
+		std::printf("%-48s %12.1f ns/op %10.2f allocs/op %10.1f B/op\n", name, ns / iterations,
+			static_cast<double>(allocs) / iterations, static_cast<double>(bytes) / iterations);
+	}
+}
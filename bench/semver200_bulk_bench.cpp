@@ -0,0 +1,56 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string>
+#include <thread>
+#include "benchmark.h"
+#include "semver200_bulk.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const size_t count = 2000000;
+	string input;
+	for (size_t i = 0; i < count; ++i) {
+		size_t h = i * 2654435761u;
+		input += to_string(h % 20) + "." + to_string(h / 20 % 50) + "." + to_string(h / 1000 % 30);
+		if (h % 4 == 0) input += "-rc." + to_string(h / 3 % 9);
+		if (h % 9 == 0) input += "+build." + to_string(i);
+		input += "\n";
+	}
+
+	printf("%u hardware threads\n", thread::hardware_concurrency());
+	for (const unsigned threads : { 1u, 2u, 4u, 8u, 16u }) {
+		const string name = "parse_versions_bulk 2M records, " + to_string(threads) + " threads";
+		bench::run(name.c_str(), 1, [&](size_t) {
+			Bulk_options o;
+			o.threads = threads;
+			bench::sink += parse_versions_bulk(input.data(), input.size(), o).versions.size();
+		});
+	}
+	return 0;
+}
@@ -0,0 +1,47 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const Semver200_comparator c;
+	const vector<string> versions = { "1.2.3", "1.10.0-rc.1", "2.3.4-beta.11+exp.sha.5114f85", "1.2.3-alpha" };
+	const string minimum = "1.2.0";
+
+	bench::run("Semver200_version >= Semver200_version", 1000000, [&](size_t i) {
+		bench::sink += Semver200_version(versions[i % versions.size()]) >= Semver200_version(minimum);
+	});
+	bench::run("compare on strings", 1000000, [&](size_t i) {
+		bench::sink += c.compare(versions[i % versions.size()], minimum) >= 0;
+	});
+	return 0;
+}
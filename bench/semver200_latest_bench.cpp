@@ -0,0 +1,96 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "semver200_latest.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+namespace {
+	/// Previous approach: one version guarded by a mutex.
+	struct Locked_latest {
+		bool publish(const Semver200_version& v) {
+			lock_guard<mutex> l(m);
+			if (has && !(v > latest)) return false;
+			latest = v;
+			has = true;
+			return true;
+		}
+
+		int latest_major() {
+			lock_guard<mutex> l(m);
+			return latest.major();
+		}
+
+		mutex m;
+		Semver200_version latest;
+		bool has = false;
+	};
+
+	/// Run ops operations split among threads, where every eighth operation is a publish and others read.
+	template<typename Publish, typename Read>
+	void mixed(const unsigned threads, const size_t ops, Publish publish, Read read) {
+		vector<thread> pool;
+		for (unsigned t = 0; t < threads; ++t) {
+			pool.emplace_back([&, t]() {
+				for (size_t i = t; i < ops; i += threads) {
+					if (i % 8 == 0) {
+						publish(i);
+					} else {
+						bench::sink += static_cast<size_t>(read());
+					}
+				}
+			});
+		}
+		for (auto& th : pool) th.join();
+	}
+}
+
+int main() {
+	vector<Semver200_version> versions;
+	for (int i = 0; i < 4096; ++i) versions.emplace_back("1." + to_string(i / 64) + "." + to_string(i % 64));
+
+	for (const unsigned threads : { 1u, 4u }) {
+		const size_t ops = 2000000;
+		Locked_latest locked;
+		bench::run(("mutex-guarded version, " + to_string(threads) + " threads, 2M ops").c_str(), 1, [&](size_t) {
+			mixed(threads, ops, [&](size_t i) { locked.publish(versions[i / 8 % versions.size()]); },
+				[&]() { return locked.latest_major(); });
+		});
+		Semver200_latest_version tracker;
+		tracker.publish(versions[0]);
+		bench::run(("Semver200_latest_version, " + to_string(threads) + " threads, 2M ops").c_str(), 1, [&](size_t) {
+			mixed(threads, ops, [&](size_t i) { tracker.publish(versions[i / 8 % versions.size()]); },
+				[&]() { return tracker.latest()->major(); });
+		});
+	}
+	return 0;
+}
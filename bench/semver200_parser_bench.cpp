@@ -0,0 +1,93 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+#include "semver200_lazy_version.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const Semver200_parser p;
+
+	const vector<string> normal = { "1.2.3", "0.10.0", "12.0.1", "3.14.159" };
+	const vector<string> prerelease = { "1.0.0-alpha", "1.0.0-rc.1", "2.3.4-beta.11+exp.sha.5114f85",
+		"1.0.0-x.7.z.92" };
+	const vector<string> long_build = {
+		"10.20.30-alpha.1.beta.2.rc.3+git.5114f85e9c1d2f0b8a7e6d5c4b3a29180f7e6d5c.ci.123456789",
+		"4.5.6+20230914T101112Z.branch-feature-very-long-name.build-000123456" };
+	const vector<string> invalid = { "01.2.3", "1.2", "1.2.3-", "1.2.3-a..b", "1.2.3+b#1" };
+
+	bench::run("parse normal", 2000000, [&](size_t i) {
+		bench::sink += p.parse(normal[i % normal.size()]).patch;
+	});
+	bench::run("parse prerelease+build", 1000000, [&](size_t i) {
+		bench::sink += p.parse(prerelease[i % prerelease.size()]).prerelease_ids.size();
+	});
+	bench::run("parse long build metadata", 500000, [&](size_t i) {
+		bench::sink += p.parse(long_build[i % long_build.size()]).build_ids.size();
+	});
+	bench::run("parse_view prerelease+build", 1000000, [&](size_t i) {
+		const string& s = prerelease[i % prerelease.size()];
+		bench::sink += p.parse_view(s.data(), s.size()).prerelease.size;
+	});
+	bench::run("parse_view long build metadata", 1000000, [&](size_t i) {
+		const string& s = long_build[i % long_build.size()];
+		bench::sink += p.parse_view(s.data(), s.size()).build.size;
+	});
+	bench::run("construct Semver200_version", 1000000, [&](size_t i) {
+		bench::sink += Semver200_version(prerelease[i % prerelease.size()]).major();
+	});
+	bench::run("construct Semver200_lazy_version", 1000000, [&](size_t i) {
+		bench::sink += Semver200_lazy_version(prerelease[i % prerelease.size()]).major();
+	});
+	Identifier_pool pool;
+	bench::run("parse interned prerelease+build", 1000000, [&](size_t i) {
+		const string& s = prerelease[i % prerelease.size()];
+		bench::sink += p.parse(s.data(), s.size(), pool).prerelease_ids.size();
+	});
+	Identifier_pool shared_pool(true);
+	bench::run("parse interned, thread-safe pool", 1000000, [&](size_t i) {
+		const string& s = prerelease[i % prerelease.size()];
+		bench::sink += p.parse(s.data(), s.size(), shared_pool).prerelease_ids.size();
+	});
+	bench::run("parse invalid", 500000, [&](size_t i) {
+		try {
+			p.parse(invalid[i % invalid.size()]);
+		} catch (Parse_error&) {
+			bench::sink += 1;
+		}
+	});
+	bench::run("try_parse invalid", 500000, [&](size_t i) {
+		const string& s = invalid[i % invalid.size()];
+		Version_view v{ 0, 0, 0, String_ref(), String_ref() };
+		bench::sink += static_cast<size_t>(p.try_parse(s.data(), s.size(), v).code);
+	});
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+#include "semver200_range_index.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const size_t count = 200000;
+	const vector<string> ops = { "^", "~", "=", "1.x || ^" };
+	vector<pair<size_t, Semver200_range>> ranges;
+	ranges.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		string r = ops[i % ops.size()] + to_string(i % 97) + "." + to_string(i % 13) + "." + to_string(i % 7);
+		ranges.emplace_back(i, Semver200_range{ r });
+	}
+
+	Semver200_range_index idx;
+	bench::run("build index over 200k ranges", 1, [&](size_t) {
+		idx.clear();
+		idx.insert(ranges.begin(), ranges.end());
+	});
+
+	const Semver200_parser parser;
+	vector<Version_data> queries;
+	for (size_t i = 0; i < 64; ++i) {
+		queries.push_back(parser.parse(to_string(i % 97) + "." + to_string(i % 13) + "." + to_string(i % 11)));
+	}
+	bench::run("linear scan with satisfies()", 64, [&](size_t i) {
+		size_t n = 0;
+		for (const auto& r : ranges) n += r.second.satisfies(queries[i % queries.size()]);
+		bench::sink += n;
+	});
+	vector<Semver200_range_index::Id> found;
+	bench::run("Semver200_range_index::find", 64, [&](size_t i) {
+		found.clear();
+		idx.find(queries[i % queries.size()], found);
+		bench::sink += found.size();
+	});
+	return 0;
+}
@@ -0,0 +1,95 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "semver200_registry.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const int packages = 1000;
+	Semver200_registry registry;
+	vector<string> names;
+	for (int p = 0; p < packages; ++p) {
+		names.push_back("package-" + to_string(p));
+		vector<Semver200_version> versions;
+		for (int i = 0; i < 50; ++i) versions.emplace_back(to_string(i / 10) + "." + to_string(i % 10) + ".0");
+		registry.insert(names.back(), versions.begin(), versions.end());
+	}
+	const vector<Semver200_range> ranges = { Semver200_range("^1.2"), Semver200_range("~3.4.0"),
+		Semver200_range(">=2.0.0 <4.0.0"), Semver200_range("*") };
+
+	printf("%u hardware threads\n", thread::hardware_concurrency());
+	{
+		// Filling a registry with many packages must not copy the packages already present.
+		const int loaded = 100000;
+		vector<string> load_names;
+		for (int p = 0; p < loaded; ++p) load_names.push_back("load-" + to_string(p));
+		const Semver200_version v("1.0.0");
+		Semver200_registry fresh;
+		const auto start = chrono::steady_clock::now();
+		for (const auto& name : load_names) fresh.insert(name, v);
+		const double s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		printf("insert %d new packages %12.2f ms\n", loaded, s * 1e3);
+	}
+	for (const unsigned readers : { 1u, 2u, 4u, 8u }) {
+		// One ingest thread keeps appending while readers resolve ranges for random packages.
+		atomic<bool> done{ false };
+		thread writer([&]() {
+			for (int i = 0; !done.load(memory_order_relaxed); ++i) {
+				registry.insert(names[static_cast<size_t>(i) % names.size()],
+					Semver200_version("5." + to_string(i / packages) + ".0"));
+			}
+		});
+		const size_t lookups = 200000;
+		vector<thread> pool;
+		const auto start = chrono::steady_clock::now();
+		for (unsigned t = 0; t < readers; ++t) {
+			pool.emplace_back([&, t]() {
+				size_t found = 0;
+				for (size_t i = 0; i < lookups; ++i) {
+					const size_t h = (i * readers + t) * 2654435761u;
+					found += registry.max_satisfying(names[h % names.size()], ranges[h / 7 % ranges.size()]) != nullptr;
+				}
+				bench::sink += found;
+			});
+		}
+		for (auto& th : pool) th.join();
+		const double s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		done = true;
+		writer.join();
+		printf("max_satisfying, %u reader threads + 1 writer %12.2f M lookups/s\n", readers,
+			static_cast<double>(lookups) * readers / s / 1e6);
+	}
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+#include "semver200_sort.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const size_t count = 1000000;
+	vector<Semver200_version> src;
+	src.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		size_t h = i * 2654435761u;
+		string s = to_string(h % 40) + "." + to_string(h / 40 % 60) + "." + to_string(h / 2400 % 100);
+		if (h % 10 == 0) s += "-rc." + to_string(h / 7 % 9);
+		src.emplace_back(s);
+	}
+
+	bench::run("std::sort 1M Semver200_version", 1, [&](size_t) {
+		auto v = src;
+		sort(v.begin(), v.end());
+		bench::sink += v.front().major();
+	});
+	bench::run("sort_versions, 1 thread", 1, [&](size_t) {
+		auto v = src;
+		sort_versions(v);
+		bench::sink += v.front().major();
+	});
+	Sort_options o;
+	o.threads = 0;
+	bench::run("sort_versions, all threads", 1, [&](size_t) {
+		auto v = src;
+		sort_versions(v, o);
+		bench::sink += v.front().major();
+	});
+	return 0;
+}
@@ -0,0 +1,69 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "benchmark.h"
+#include "semver200.h"
+#include "semver200_stream.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+namespace {
+	struct Counting_visitor : Record_visitor {
+		void version(const Version_view& v, const size_t) override { bench::sink += v.major; }
+		void error(const Record_error&) override { ++bench::sink; }
+	};
+}
+
+int main() {
+	const char* const path = "semver200_stream_bench.tmp";
+	const size_t count = 1000000;
+	{
+		ofstream os(path, ios::binary);
+		for (size_t i = 0; i < count; ++i) {
+			size_t h = i * 2654435761u;
+			os << h % 20 << "." << h / 20 % 50 << "." << h / 1000 % 30;
+			if (h % 4 == 0) os << "-rc." << h / 3 % 9;
+			if (h % 9 == 0) os << "+build." << i;
+			os << "\n";
+		}
+	}
+
+	bench::run("getline + Semver200_version, 1M records", 1, [&](size_t) {
+		ifstream is(path, ios::binary);
+		string line;
+		while (getline(is, line)) bench::sink += Semver200_version(line).major();
+	});
+	bench::run("parse_version_file, 1M records", 1, [&](size_t) {
+		Counting_visitor v;
+		parse_version_file(path, v);
+	});
+	remove(path);
+	return 0;
+}
@@ -0,0 +1,186 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+namespace {
+	/// Deterministic pseudo-random number for corpus index.
+	size_t scramble(const size_t i) {
+		size_t h = (i + 1) * 0x9e3779b97f4a7c15u;
+		return h ^ (h >> 29);
+	}
+
+	/// Versions shaped like a package registry: mostly releases, some prereleases, few build suffixes.
+	vector<string> short_corpus(const size_t n) {
+		static const char* const tags[] = { "alpha", "beta", "rc", "next", "canary" };
+		vector<string> r;
+		for (size_t i = 0; i < n; ++i) {
+			const size_t h = scramble(i);
+			string s = to_string(h % 12) + "." + to_string(h / 12 % 40) + "." + to_string(h / 480 % 25);
+			if (h % 5 == 0) s += "-" + string(tags[h / 7 % 5]) + "." + to_string(h / 11 % 12);
+			if (h % 17 == 0) s += "+build." + to_string(h / 13 % 1000);
+			r.push_back(move(s));
+		}
+		return r;
+	}
+
+	/// Versions with multi-digit components, deep prerelease and long build metadata, as made by CI pipelines.
+	vector<string> long_corpus(const size_t n) {
+		vector<string> r;
+		for (size_t i = 0; i < n; ++i) {
+			const size_t h = scramble(i);
+			r.push_back(to_string(2000 + h % 30) + "." + to_string(h / 30 % 1000) + "." + to_string(h / 30000 % 10000)
+				+ "-nightly.feature-branch-" + to_string(h / 7 % 50) + ".build." + to_string(h / 3 % 100000)
+				+ ".x86-64+sha." + to_string(h % 0xfffffff) + ".ci.pipeline." + to_string(h / 5 % 10000));
+		}
+		return r;
+	}
+
+	/// Pairs equal in major.minor.patch and in long common prerelease prefix, differing near the end.
+	vector<string> deep_prerelease_corpus(const size_t n) {
+		vector<string> r;
+		for (size_t i = 0; i < n; ++i) {
+			r.push_back("3.1.4-alpha.beta.gamma.delta.epsilon.zeta." + to_string(scramble(i) % 1000) + ".final");
+		}
+		return r;
+	}
+}
+
+int main() {
+	const size_t n = 1024;
+	const vector<string> shorts = short_corpus(n);
+	const vector<string> longs = long_corpus(n);
+	const vector<string> deep = deep_prerelease_corpus(n);
+	const vector<string> invalid = { "1.2", "01.2.3", "1.2.3-", "1.2.3-a..b", "v1.2.3", "1.2.3+b#1", "1.2.3-01",
+		"1..3" };
+	vector<string> numeric;
+	for (size_t i = 0; i < n; ++i) {
+		const size_t h = scramble(i);
+		numeric.push_back(to_string(h % 3) + "." + to_string(h / 3 % 3) + "." + to_string(h / 9 % 3));
+	}
+
+	const Semver200_parser parser;
+	bench::run("parse short", 500000, [&](size_t i) {
+		bench::sink += parser.parse(shorts[i % n]).major;
+	});
+	bench::run("parse long", 200000, [&](size_t i) {
+		bench::sink += parser.parse(longs[i % n]).major;
+	});
+	bench::run("parse_packed short", 500000, [&](size_t i) {
+		const string& s = shorts[i % n];
+		bench::sink += parser.parse_packed(s.data(), s.size()).major();
+	});
+	bench::run("parse_packed long", 200000, [&](size_t i) {
+		const string& s = longs[i % n];
+		bench::sink += parser.parse_packed(s.data(), s.size()).major();
+	});
+	// Initial buffer fits a whole batch, so the arena never goes upstream once warmed up.
+	vector<char> arena_buffer(4 << 20);
+	Monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size());
+	bench::run("parse short into monotonic arena", 500000, [&](size_t i) {
+		// Arena is dropped in one go after each batch of versions, as after a request.
+		if (i % n == 0) arena.release();
+		const string& s = shorts[i % n];
+		bench::sink += parser.parse(s.data(), s.size(), &arena).major;
+	});
+	bench::run("parse long into monotonic arena", 200000, [&](size_t i) {
+		if (i % n == 0) arena.release();
+		const string& s = longs[i % n];
+		bench::sink += parser.parse(s.data(), s.size(), &arena).major;
+	});
+	bench::run("parse invalid, throwing", 100000, [&](size_t i) {
+		try {
+			bench::sink += parser.parse(invalid[i % invalid.size()]).major;
+		} catch (const Parse_error&) {
+			++bench::sink;
+		}
+	});
+	bench::run("try_parse invalid", 500000, [&](size_t i) {
+		const string& s = invalid[i % invalid.size()];
+		Version_view v;
+		bench::sink += parser.try_parse(s.data(), s.size(), v).offset;
+	});
+
+	const Semver200_comparator comparator;
+	vector<Version_data> numeric_data, deep_data;
+	for (const auto& s : numeric) numeric_data.push_back(parser.parse(s));
+	for (const auto& s : deep) deep_data.push_back(parser.parse(s));
+	bench::run("compare numeric-only", 2000000, [&](size_t i) {
+		bench::sink += comparator.compare(numeric_data[i % n], numeric_data[(i + 1) % n]) + 1;
+	});
+	bench::run("compare deep prerelease", 2000000, [&](size_t i) {
+		bench::sink += comparator.compare(deep_data[i % n], deep_data[(i + 1) % n]) + 1;
+	});
+
+	vector<Semver200_version> versions(shorts.begin(), shorts.end());
+	using Modified = Basic_version<Semver200_parser, Semver200_comparator, Semver200_modifier>;
+	const auto modify = [&](const char* name, Modified (*f)(const Semver200_version&, size_t)) {
+		bench::run(name, 300000, [&](size_t i) { bench::sink += f(versions[i % n], i).minor(); });
+	};
+	modify("set_major", [](const Semver200_version& v, size_t i) { return v.set_major(static_cast<int>(i % 9)); });
+	modify("set_minor", [](const Semver200_version& v, size_t i) { return v.set_minor(static_cast<int>(i % 9)); });
+	modify("set_patch", [](const Semver200_version& v, size_t i) { return v.set_patch(static_cast<int>(i % 9)); });
+	modify("set_prerelease", [](const Semver200_version& v, size_t) { return v.set_prerelease("rc.1"); });
+	modify("set_build", [](const Semver200_version& v, size_t) { return v.set_build("sha.5114f85"); });
+	modify("reset_major", [](const Semver200_version& v, size_t i) { return v.reset_major(static_cast<int>(i % 9)); });
+	modify("reset_minor", [](const Semver200_version& v, size_t i) { return v.reset_minor(static_cast<int>(i % 9)); });
+	modify("reset_patch", [](const Semver200_version& v, size_t i) { return v.reset_patch(static_cast<int>(i % 9)); });
+	modify("reset_prerelease", [](const Semver200_version& v, size_t) { return v.reset_prerelease("rc.1"); });
+	modify("reset_build", [](const Semver200_version& v, size_t) { return v.reset_build("sha.5114f85"); });
+	modify("inc_major", [](const Semver200_version& v, size_t) { return v.inc_major(); });
+	modify("inc_minor", [](const Semver200_version& v, size_t) { return v.inc_minor(); });
+	modify("inc_patch", [](const Semver200_version& v, size_t) { return v.inc_patch(); });
+
+	vector<Semver200_version> long_versions(longs.begin(), longs.end());
+	ostringstream os;
+	bench::run("operator<< short", 500000, [&](size_t i) {
+		os.seekp(0);
+		os << versions[i % n];
+		bench::sink += static_cast<size_t>(os.tellp());
+	});
+	bench::run("operator<< long", 500000, [&](size_t i) {
+		os.seekp(0);
+		os << long_versions[i % n];
+		bench::sink += static_cast<size_t>(os.tellp());
+	});
+
+	vector<Semver200_version> sort_src;
+	for (size_t i = 0; i < 64 * n; ++i) sort_src.push_back(versions[scramble(i) % n]);
+	bench::run("copy and std::sort 64K versions", 1, [&](size_t) {
+		auto v = sort_src;
+		sort(v.begin(), v.end());
+		bench::sink += v.front().major();
+	});
+	return 0;
+}
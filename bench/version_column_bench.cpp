@@ -0,0 +1,70 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+#include "version_column.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+int main() {
+	const size_t count = 1000000;
+	vector<string> src;
+	src.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		string s = to_string(i % 7) + "." + to_string(i % 31) + "." + to_string(i % 101);
+		if (i % 3 == 0) s += "-rc." + to_string(i % 5);
+		if (i % 4 == 0) s += "+build." + to_string(i);
+		src.push_back(s);
+	}
+
+	vector<Semver200_version> objects;
+	Version_column column;
+	bench::run("parse into vector<Semver200_version>", 1, [&](size_t) {
+		objects.clear();
+		objects.reserve(count);
+		for (const auto& s : src) objects.emplace_back(s);
+	});
+	bench::run("parse_all into Version_column", 1, [&](size_t) {
+		column.clear();
+		column.reserve(count, count * 8);
+		column.parse_all(src.begin(), src.end());
+	});
+	bench::run("scan majors of vector<Semver200_version>", 20, [&](size_t) {
+		size_t n = 0;
+		for (const auto& v : objects) n += v.major() == 3;
+		bench::sink += n;
+	});
+	bench::run("scan majors of Version_column", 20, [&](size_t) {
+		size_t n = 0;
+		for (const int m : column.majors()) n += m == 3;
+		bench::sink += n;
+	});
+	return 0;
+}
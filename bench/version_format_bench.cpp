@@ -0,0 +1,78 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+namespace {
+	/// Formatting as done before to_chars: every part goes through its own string stream.
+	string stream_format(const Semver200_version& v) {
+		auto join = [](const vector<string>& parts) {
+			stringstream ss;
+			for (size_t i = 0; i < parts.size(); ++i) ss << (i ? "." : "") << parts[i];
+			return ss.str();
+		};
+		vector<string> pre;
+		for (const auto& id : v.data().prerelease_ids) pre.push_back(id.first);
+		stringstream ss;
+		ss << v.major() << "." << v.minor() << "." << v.patch();
+		const string p = join(pre);
+		if (!p.empty()) ss << "-" << p;
+		const string b = join(v.data().build_ids);
+		if (!b.empty()) ss << "+" << b;
+		return ss.str();
+	}
+}
+
+int main() {
+	const vector<Semver200_version> versions = { Semver200_version("1.2.3"), Semver200_version("1.0.0-rc.1"),
+		Semver200_version("2.3.4-beta.11+exp.sha.5114f85"), Semver200_version("10.20.30+build.2023.09.14") };
+
+	bench::run("string streams per part (old operator<<)", 500000, [&](size_t i) {
+		bench::sink += stream_format(versions[i % versions.size()]).size();
+	});
+	ostringstream os;
+	bench::run("operator<< into reused ostringstream", 2000000, [&](size_t i) {
+		os.str(string());
+		os << versions[i % versions.size()];
+		bench::sink += static_cast<size_t>(os.tellp());
+	});
+	bench::run("prerelease() + build()", 2000000, [&](size_t i) {
+		const auto& v = versions[i % versions.size()];
+		bench::sink += v.prerelease().size() + v.build().size();
+	});
+	char buf[64];
+	bench::run("to_chars into caller buffer", 5000000, [&](size_t i) {
+		bench::sink += versions[i % versions.size()].to_chars(buf, sizeof(buf));
+	});
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "semver200.h"
+
+using namespace std;
+using namespace version;
+
+volatile size_t bench::sink;
+
+namespace {
+	/// Version wrapper with copy operations only, reproducing the behaviour before move support.
+	struct Copy_only_version {
+		Copy_only_version(const string& s) : v(s) {}
+		Copy_only_version(const Copy_only_version&) = default;
+		Copy_only_version& operator=(const Copy_only_version&) = default;
+
+		Semver200_version v;
+	};
+
+	bool operator<(const Copy_only_version& l, const Copy_only_version& r) {
+		return l.v < r.v;
+	}
+
+	/// Run function once and report number of heap allocations it made.
+	template<typename F>
+	void count_allocations(const char* name, const size_t ops, F f) {
+		const size_t before = bench::allocations;
+		f();
+		printf("%-48s %12.2f allocs/op\n", name, static_cast<double>(bench::allocations - before) / ops);
+	}
+}
+
+int main() {
+	const size_t count = 100000;
+	vector<string> src;
+	src.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		size_t h = i * 2654435761u;
+		src.push_back(to_string(h % 10) + "." + to_string(h / 10 % 20) + ".0-rc." + to_string(h / 200 % 9)
+			+ "+build." + to_string(i));
+	}
+	vector<Copy_only_version> copied(src.begin(), src.end());
+	vector<Semver200_version> moved(src.begin(), src.end());
+
+	count_allocations("std::sort, copy-only versions", count, [&]() { sort(copied.begin(), copied.end()); });
+	count_allocations("std::sort, movable versions", count, [&]() { sort(moved.begin(), moved.end()); });
+
+	const Semver200_version base("1.2.3-alpha.1+build.5");
+	count_allocations("modifier chain on lvalues", 1000, [&]() {
+		for (int i = 0; i < 1000; ++i) {
+			auto a = base.set_major(2);
+			auto b = a.set_minor(i);
+			auto c = b.set_prerelease("rc.1");
+			bench::sink += c.minor();
+		}
+	});
+	count_allocations("modifier chain on rvalues", 1000, [&]() {
+		for (int i = 0; i < 1000; ++i) {
+			bench::sink += Semver200_version(base).set_major(2).set_minor(i).set_prerelease("rc.1").minor();
+		}
+	});
+
+	bench::run("modifier chain on lvalues", 200000, [&](size_t i) {
+		auto a = base.set_major(2);
+		auto b = a.set_minor(static_cast<int>(i % 100));
+		auto c = b.set_prerelease("rc.1");
+		bench::sink += c.minor();
+	});
+	bench::run("modifier chain on rvalues", 200000, [&](size_t i) {
+		bench::sink += Semver200_version(base).set_major(2).set_minor(static_cast<int>(i % 100))
+			.set_prerelease("rc.1").minor();
+	});
+	return 0;
+}
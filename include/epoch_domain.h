@@ -0,0 +1,115 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace version {
+
+	/// Epoch-based reclamation of objects that are replaced while readers may still be using them.
+	/**
+	Readers bracket each access with a Read_guard, which counts them as active in the current epoch. The count
+	is kept on one of several counters, assigned to threads in turn, so readers rarely share a cache line and
+	never block or take a lock. A writer that replaces an object stamps the old one with epoch() after the
+	replacement has been published, and frees it once expired() says the epoch has since moved on twice.
+	advance() moves the epoch only past epochs whose readers have all left, and never waits for them, so
+	objects are freed by whichever later call to advance() finds their readers gone.
+	*/
+	class Epoch_domain {
+	public:
+		/// Counts the calling thread as a reader of the current epoch for the lifetime of the guard.
+		/**
+		Epoch is checked again after the counter is raised, so a reader is never counted in an epoch that has
+		already ended. Like all operations on the epoch and the counters, this is sequentially consistent: a
+		writer reading the epoch after publishing a replacement must know that readers of any later epoch see
+		the replacement.
+		*/
+		class Read_guard {
+		public:
+			explicit Read_guard(const Epoch_domain& d) {
+				Reader_stripe& stripe = d.readers_[reader_stripe()];
+				for (;;) {
+					const std::uint64_t e = d.epoch_.load();
+					counter_ = &stripe.active[e & 1];
+					counter_->fetch_add(1);
+					if (d.epoch_.load() == e) return;
+					counter_->fetch_sub(1);
+				}
+			}
+
+			Read_guard(const Read_guard&) = delete;
+			Read_guard& operator=(const Read_guard&) = delete;
+
+			~Read_guard() {
+				counter_->fetch_sub(1);
+			}
+
+		private:
+			std::atomic<std::size_t>* counter_;
+		};
+
+		Epoch_domain();
+		Epoch_domain(const Epoch_domain&) = delete;
+		Epoch_domain& operator=(const Epoch_domain&) = delete;
+
+		/// Current epoch, to stamp an object with once its replacement has been published.
+		std::uint64_t epoch() const;
+
+		/// Move the epoch forward at most twice, as far as active readers allow, and return the resulting epoch.
+		/**
+		Must not be called while the calling thread holds a Read_guard of this domain, or the epoch cannot
+		move past the guard's one.
+		*/
+		std::uint64_t advance();
+
+		/// Test if object stamped with given epoch can be freed once the domain has reached the current one.
+		static bool expired(const std::uint64_t stamp, const std::uint64_t current) {
+			return stamp + 2 <= current;
+		}
+
+	private:
+		/// Counters of readers active in even and odd epochs, padded to a cache line of their own.
+		struct Reader_stripe {
+			std::atomic<std::size_t> active[2];
+			char padding[64 - 2 * sizeof(std::atomic<std::size_t>)];
+		};
+
+		/// Counter stripe of the calling thread; threads are assigned to stripes in turn.
+		static std::size_t reader_stripe() {
+			static thread_local const std::size_t stripe = next_stripe();
+			return stripe;
+		}
+
+		static std::size_t next_stripe();
+		void advance_once();
+
+		std::unique_ptr<Reader_stripe[]> readers_;
+		std::atomic<std::uint64_t> epoch_;
+	};
+}
@@ -0,0 +1,115 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "version.h"
+#include "version_view.h"
+
+namespace version {
+
+	/// Handle of identifier text stored in an Identifier_pool.
+	/**
+	All handles of equal text obtained from the same pool point to the same string, so they are compared for
+	equality by address. Handle remains valid for the lifetime of the pool.
+	*/
+	struct Interned_identifier {
+		const std::string* text;
+
+		const std::string& str() const { return *text; }
+	};
+
+	inline bool operator==(const Interned_identifier& l, const Interned_identifier& r) {
+		return l.text == r.text;
+	}
+
+	inline bool operator!=(const Interned_identifier& l, const Interned_identifier& r) {
+		return l.text != r.text;
+	}
+
+	/// Interned prerelease identifier and its type.
+	using Interned_prerelease_identifier = std::pair<Interned_identifier, Id_type>;
+
+	/// Version whose prerelease and build identifiers share storage through an Identifier_pool.
+	/**
+	Like Version_data, but each identifier is a handle into the pool rather than a separate std::string, so
+	repetitive identifiers ("alpha", "rc", CI branch names) are stored once per pool. Versions compared with
+	each other must come from the same pool.
+	*/
+	struct Interned_version {
+		int major; ///< Major version.
+		int minor; ///< Minor version.
+		int patch; ///< Patch version.
+		std::vector<Interned_prerelease_identifier> prerelease_ids; ///< Interned prerelease identifiers.
+		std::vector<Interned_identifier> build_ids; ///< Interned build identifiers.
+
+		/// Copy identifiers into self-contained Version_data.
+		Version_data to_data() const;
+	};
+
+	/// Set of unique identifier strings handed out as Interned_identifier handles.
+	/**
+	Strings are never removed or moved, so handles stay valid until the pool is destroyed. Lookup hashes the
+	text in place and allocates only when a new identifier is added.
+
+	A pool created as thread-safe may be used by several threads at once: interning is serialized by a mutex
+	while reading interned text needs no locking. Default pool skips locking and may only be used by one
+	thread at a time.
+	*/
+	class Identifier_pool {
+	public:
+		explicit Identifier_pool(const bool thread_safe = false);
+
+		Identifier_pool(const Identifier_pool&) = delete;
+		Identifier_pool& operator=(const Identifier_pool&) = delete;
+
+		/// Get handle of identifier text, adding the text to the pool if it is not there yet.
+		Interned_identifier intern(const String_ref&);
+
+		/// Number of unique identifiers in the pool.
+		std::size_t size() const;
+
+		/// Test if pool may be used by several threads at once.
+		bool thread_safe() const { return thread_safe_; }
+
+	private:
+		struct Hash {
+			std::size_t operator()(const String_ref&) const;
+		};
+
+		Interned_identifier insert(const String_ref&);
+
+		std::deque<std::string> storage_;
+		std::unordered_map<String_ref, const std::string*, Hash> index_; ///< Keys reference strings in storage_.
+		mutable std::mutex mutex_;
+		const bool thread_safe_;
+	};
+}
@@ -0,0 +1,148 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace version {
+
+	/// Source of raw memory for Resource_allocator, modelled on C++17 std::pmr::memory_resource.
+	/**
+	Alignments beyond alignof(std::max_align_t) are not supported.
+	*/
+	class Memory_resource {
+	public:
+		virtual ~Memory_resource() = default;
+
+		void* allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+			return do_allocate(bytes, alignment);
+		}
+
+		void deallocate(void* p, const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+			do_deallocate(p, bytes, alignment);
+		}
+
+		/// Test if memory allocated from one resource can be deallocated by the other.
+		bool is_equal(const Memory_resource& o) const noexcept { return this == &o || do_is_equal(o); }
+
+	protected:
+		virtual void* do_allocate(const std::size_t bytes, const std::size_t alignment) = 0;
+		virtual void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) = 0;
+		virtual bool do_is_equal(const Memory_resource&) const noexcept { return false; }
+	};
+
+	/// Resource that uses global operator new and delete; default resource of Resource_allocator.
+	Memory_resource* new_delete_resource() noexcept;
+
+	/// Arena that hands out memory by bumping a pointer and frees it only all at once.
+	/**
+	Memory is taken from an optional caller-supplied initial buffer and then from blocks obtained from the
+	upstream resource, each twice as large as the previous one. deallocate() does nothing; release() returns
+	all blocks to upstream, as does the destructor, and restarts growth from the first block size. Not
+	thread-safe.
+	*/
+	class Monotonic_buffer_resource : public Memory_resource {
+	public:
+		explicit Monotonic_buffer_resource(const std::size_t initial_size = 1024,
+			Memory_resource* upstream = new_delete_resource());
+
+		/// Use given buffer first; buffer is not owned and must outlive the resource.
+		Monotonic_buffer_resource(void* buffer, const std::size_t size, Memory_resource* upstream = new_delete_resource());
+
+		Monotonic_buffer_resource(const Monotonic_buffer_resource&) = delete;
+		Monotonic_buffer_resource& operator=(const Monotonic_buffer_resource&) = delete;
+		~Monotonic_buffer_resource();
+
+		/// Free all memory handed out so far and start again from the initial buffer.
+		void release();
+
+		/// Number of bytes handed out since construction or last release(), excluding alignment padding.
+		std::size_t bytes_allocated() const { return allocated_; }
+
+	protected:
+		void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+		void do_deallocate(void*, const std::size_t, const std::size_t) override {}
+
+	private:
+		struct Block {
+			Block* next;
+			std::size_t size;
+		};
+
+		Memory_resource* upstream_;
+		char* initial_buffer_;
+		std::size_t initial_size_;
+		char* current_;
+		std::size_t remaining_;
+		std::size_t first_block_size_;
+		std::size_t next_size_;
+		std::size_t allocated_;
+		Block* blocks_;
+	};
+
+	/// Allocator drawing memory from a Memory_resource, modelled on C++17 std::pmr::polymorphic_allocator.
+	/**
+	Copies of containers do not inherit the resource of the original, but use new_delete_resource(), so that
+	a copy can outlive the arena the original was allocated from.
+	*/
+	template<typename T>
+	class Resource_allocator {
+	public:
+		using value_type = T;
+
+		Resource_allocator() noexcept : resource_{ new_delete_resource() } {}
+		Resource_allocator(Memory_resource* r) noexcept : resource_{ r } {}
+
+		template<typename U>
+		Resource_allocator(const Resource_allocator<U>& o) noexcept : resource_{ o.resource() } {}
+
+		T* allocate(const std::size_t n) {
+			if (n > static_cast<std::size_t>(-1) / sizeof(T)) throw std::bad_alloc();
+			return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* p, const std::size_t n) {
+			resource_->deallocate(p, n * sizeof(T), alignof(T));
+		}
+
+		Resource_allocator select_on_container_copy_construction() const { return Resource_allocator(); }
+
+		Memory_resource* resource() const { return resource_; }
+
+	private:
+		Memory_resource* resource_;
+	};
+
+	template<typename T, typename U>
+	inline bool operator==(const Resource_allocator<T>& l, const Resource_allocator<U>& r) {
+		return l.resource()->is_equal(*r.resource());
+	}
+
+	template<typename T, typename U>
+	inline bool operator!=(const Resource_allocator<T>& l, const Resource_allocator<U>& r) {
+		return !(l == r);
+	}
+}
@@ -0,0 +1,105 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "version.h"
+#include "version_view.h"
+
+namespace version {
+
+	/// Self-contained version stored in a single block with small buffer optimization.
+	/**
+	Normal components are kept inline next to the prerelease and build text, which is stored dot-separated
+	as in the version string, prerelease first, without the leading '-' and '+'. Text of up to inline_capacity
+	bytes lives inside the object, so a typical version such as 1.2.3-rc.1 needs no heap allocation at all;
+	longer text takes exactly one. Identifier boundaries and types are not stored but recovered from the text
+	while iterating, as for Version_view.
+
+	Packed_version does not validate its contents; it is produced by Semver200_parser::parse_packed() and
+	Semver200_modifier, which do. Text is limited to 4 GiB.
+	*/
+	class Packed_version {
+	public:
+		/// Number of prerelease and build text bytes stored without heap allocation.
+		static const std::size_t inline_capacity = 24;
+
+		/// Construct version 0.0.0.
+		Packed_version();
+
+		/// Copy version from borrowed view.
+		explicit Packed_version(const Version_view&);
+
+		/// Copy version from Version_data, joining identifiers with dots.
+		explicit Packed_version(const Version_data&);
+
+		Packed_version(const Packed_version&);
+		Packed_version(Packed_version&&) noexcept;
+		Packed_version& operator=(const Packed_version&);
+		Packed_version& operator=(Packed_version&&) noexcept;
+		~Packed_version();
+
+		int major() const { return major_; }
+		int minor() const { return minor_; }
+		int patch() const { return patch_; }
+
+		/// Prerelease text without leading '-', empty if there is none.
+		String_ref prerelease() const { return String_ref(text(), prerelease_size_); }
+
+		/// Build text without leading '+', empty if there is none.
+		String_ref build() const { return String_ref(text() + prerelease_size_, size_ - prerelease_size_); }
+
+		/// Iterate over prerelease identifiers.
+		Identifier_range<Prerelease_identifier_view> prerelease_ids() const { return{ prerelease() }; }
+
+		/// Iterate over build identifiers.
+		Identifier_range<String_ref> build_ids() const { return{ build() }; }
+
+		/// Borrowed view of this version, valid until the version is modified or destroyed.
+		Version_view view() const { return Version_view{ major_, minor_, patch_, prerelease(), build() }; }
+
+		/// Copy version into Version_data.
+		Version_data to_data() const { return view().to_data(); }
+
+		/// Test if text is stored inside the object.
+		bool is_inline() const { return size_ <= inline_capacity; }
+
+	private:
+		const char* text() const { return is_inline() ? inline_ : heap_; }
+		void assign(const int, const int, const int, const String_ref&, const String_ref&);
+		void release();
+
+		int major_;
+		int minor_;
+		int patch_;
+		std::uint32_t size_; ///< Total size of prerelease and build text.
+		std::uint32_t prerelease_size_;
+		union {
+			char inline_[inline_capacity];
+			char* heap_;
+		};
+	};
+}
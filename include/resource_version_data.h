@@ -0,0 +1,70 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "memory_resource.h"
+#include "version.h"
+
+namespace version {
+
+	/// String allocated from a Memory_resource.
+	using Resource_string = std::basic_string<char, std::char_traits<char>, Resource_allocator<char>>;
+
+	/// Prerelease identifier allocated from a Memory_resource.
+	using Resource_prerelease_identifier = std::pair<Resource_string, Id_type>;
+
+	/// Prerelease identifiers allocated from a Memory_resource.
+	using Resource_prerelease_identifiers =
+		std::vector<Resource_prerelease_identifier, Resource_allocator<Resource_prerelease_identifier>>;
+
+	/// Build identifiers allocated from a Memory_resource.
+	using Resource_build_identifiers = std::vector<Resource_string, Resource_allocator<Resource_string>>;
+
+	/// Version_data whose identifier vectors and strings are allocated from a caller-supplied Memory_resource.
+	/**
+	Parsing a batch of versions into Resource_version_data objects sharing a Monotonic_buffer_resource keeps all
+	their memory in one arena, which is released in one go instead of freeing every identifier separately.
+	The resource must outlive the objects allocated from it.
+	*/
+	struct Resource_version_data {
+		explicit Resource_version_data(Memory_resource* r = new_delete_resource())
+			: major{ 0 }, minor{ 0 }, patch{ 0 }, prerelease_ids(r), build_ids(r) {}
+
+		int major; ///< Major version.
+		int minor; ///< Minor version.
+		int patch; ///< Patch version.
+		Resource_prerelease_identifiers prerelease_ids; ///< Prerelease identifiers.
+		Resource_build_identifiers build_ids; ///< Build identifiers.
+
+		/// Resource identifiers are allocated from.
+		Memory_resource* resource() const { return prerelease_ids.get_allocator().resource(); }
+
+		/// Copy identifiers into self-contained Version_data.
+		Version_data to_data() const;
+	};
+}
@@ -24,40 +24,183 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
+#include "identifier_pool.h"
+#include "packed_version.h"
+#include "resource_version_data.h"
 #include "version.h"
+#include "version_view.h"
 
 namespace version {
 
+	/// Reason why a version string was rejected by semver 2.0.0 parser.
+	enum class Parse_errc {
+		ok, ///< No error, version string is valid
+		invalid_character, ///< Character is not allowed at its position
+		leading_zero, ///< Normal version component has leading 0
+		numeric_leading_zero, ///< Numeric prerelease identifier has leading 0
+		empty_identifier, ///< Prerelease or build identifier is empty
+		empty_number, ///< Normal version component is empty
+		unexpected_end, ///< Version string ends before patch version
+		out_of_range ///< Normal version component does not fit into int
+	};
+
+	/// Outcome of non-throwing parse.
+	struct Parse_status {
+		Parse_errc code; ///< Reason of failure, Parse_errc::ok on success.
+		std::size_t offset; ///< Byte offset at which error was detected; length of input on success.
+		char character; ///< Character at offset, or '\0' if error was detected at the end of input.
+
+		/// Test if parsing succeeded.
+		explicit operator bool() const { return code == Parse_errc::ok; }
+	};
+
 	/// Parse string into Version_data structure according to semantic versioning 2.0.0 rules.
 	struct Semver200_parser {
 		Version_data parse(const std::string&) const;
+
+		/// Parse version string given as a range of characters; the range does not need to be NUL-terminated.
+		Version_data parse(const char*, const std::size_t) const;
+
+		/// Parse version string into Version_view that references the supplied characters instead of copying them.
+		/**
+		Parsing into a view does not allocate; the source buffer must outlive the returned view.
+		*/
+		Version_view parse_view(const char*, const std::size_t) const;
+
+		/// Parse version string without throwing exceptions.
+		/**
+		On success, parsed version is stored in the output argument; on failure, output argument is left
+		unchanged and returned status describes the error. Only the exception is avoided: identifiers are
+		still copied into allocated strings as they are recognized, so both successful and rejected parses
+		may allocate. Use the Version_view overload for parsing that does not allocate.
+		*/
+		Parse_status try_parse(const char*, const std::size_t, Version_data&) const;
+
+		/// Parse version string given as std::string without throwing exceptions.
+		Parse_status try_parse(const std::string&, Version_data&) const;
+
+		/// Parse version string into a borrowed view without throwing exceptions or allocating.
+		Parse_status try_parse(const char*, const std::size_t, Version_view&) const;
+
+		/// Parse version string, sharing identifier storage through the given pool.
+		Interned_version parse(const char*, const std::size_t, Identifier_pool&) const;
+
+		/// Parse version string into interned version without throwing exceptions.
+		/**
+		Identifiers are interned only after the whole string has been validated, so rejected input adds nothing
+		to the pool.
+		*/
+		Parse_status try_parse(const char*, const std::size_t, Interned_version&, Identifier_pool&) const;
+
+		/// Parse version string into a Packed_version; short versions are stored without heap allocation.
+		Packed_version parse_packed(const char*, const std::size_t) const;
+
+		/// Parse version string into a Packed_version without throwing exceptions.
+		Parse_status try_parse(const char*, const std::size_t, Packed_version&) const;
+
+		/// Parse version string, allocating identifiers from the given memory resource.
+		Resource_version_data parse(const char*, const std::size_t, Memory_resource*) const;
+
+		/// Parse version string without throwing exceptions; identifiers are allocated from the output's resource.
+		Parse_status try_parse(const char*, const std::size_t, Resource_version_data&) const;
 	};
 
+	/// Get human-readable description of a parse error, as used in Parse_error exceptions.
+	std::string error_message(const Parse_status&);
+
 	/// Compare Version_data to another using semantic versioning 2.0.0 rules.
 	struct Semver200_comparator {
 		int compare(const Version_data&, const Version_data&) const;
+
+		/// Compare borrowed version views; does not allocate.
+		int compare(const Version_view&, const Version_view&) const;
+
+		/// Compare interned versions from the same pool; equal identifiers are recognized by address.
+		int compare(const Interned_version&, const Interned_version&) const;
+
+		/// Compare packed versions; does not allocate.
+		int compare(const Packed_version&, const Packed_version&) const;
+
+		/// Compare versions allocated from memory resources.
+		int compare(const Resource_version_data&, const Resource_version_data&) const;
+
+		/// Compare version strings directly, without parsing them into Version_data.
+		/**
+		Both strings are validated by the parser automaton into borrowed views and then compared component by
+		component, stopping at the first difference; nothing is allocated. Throws Parse_error if either string
+		is not a valid version.
+		*/
+		int compare(const char*, const std::size_t, const char*, const std::size_t) const;
+
+		/// Compare version strings given as std::string; see compare(const char*, std::size_t, const char*, std::size_t).
+		int compare(const std::string&, const std::string&) const;
+
+		/// Compare version strings without throwing; on success result holds the outcome of comparison.
+		/**
+		If the left string is invalid its status is returned, otherwise status of the right string is returned;
+		result is left unchanged on failure.
+		*/
+		Parse_status try_compare(const char*, const std::size_t, const char*, const std::size_t, int& result) const;
+	};
+
+	/// Order-preserving binary encoding of Version_data.
+	/**
+	Encoded keys compared byte by byte (memcmp, std::string::compare) are ordered exactly as the versions they
+	were encoded from are ordered by semver 2.0.0 precedence, so they can be sorted and indexed by storage
+	engines that know nothing about versions. Layout:
+	- major, minor and patch as 4-byte big-endian integers;
+	- for each prerelease identifier a type tag (numeric before alphanumeric) followed by the identifier:
+	numeric identifiers as digit count and digits, alphanumeric ones as 0-terminated text;
+	- prerelease terminator that sorts before any identifier, or release marker that sorts after all of them;
+	- optionally, 0-terminated build identifiers.
+
+	Build identifiers have no precedence, so keys of versions that differ only in build are ordered by build
+	text; encode_precedence() omits build to make such keys equal.
+	*/
+	struct Semver200_key_codec {
+		/// Encode version including build identifiers.
+		std::string encode(const Version_data&) const;
+
+		/// Encode version without build identifiers: versions of equal precedence get equal keys.
+		std::string encode_precedence(const Version_data&) const;
+
+		/// Append encoded version to the given string, e.g. after a key prefix.
+		void append(const Version_data&, std::string&, const bool with_build = true) const;
+
+		/// Decode version from key created by encode() or encode_precedence(); throws Parse_error if malformed.
+		Version_data decode(const std::string&) const;
+
+		/// Decode version from key given as a range of bytes.
+		Version_data decode(const char*, const std::size_t) const;
 	};
 
 	/// Implementation of various version modification methods.
 	/**
 	All methods are non-destructive, i.e. they return a new object with modified properties;
-	original object is never modified.
+	original object is never modified. Overloads taking an rvalue Version_data reuse its identifier
+	storage for the result instead of copying it.
 	*/
 	struct Semver200_modifier {
 		/// Set major version to specified value leaving all other components unchanged..
 		Version_data set_major(const Version_data&, const int) const;
+		Version_data set_major(Version_data&&, const int) const;
 
 		/// Set minor version to specified value leaving all other components unchanged.
 		Version_data set_minor(const Version_data&, const int) const;
+		Version_data set_minor(Version_data&&, const int) const;
 
 		/// Set patch version to specified value leaving all other components unchanged.
 		Version_data set_patch(const Version_data&, const int) const;
+		Version_data set_patch(Version_data&&, const int) const;
 
 		/// Set pre-release version to specified value leaving all other components unchanged.
-		Version_data set_prerelease(const Version_data&, const Prerelease_identifiers&) const;
+		Version_data set_prerelease(const Version_data&, Prerelease_identifiers) const;
+		Version_data set_prerelease(Version_data&&, Prerelease_identifiers) const;
 
 		/// Set build version to specified value leaving all other components unchanged.
-		Version_data set_build(const Version_data&, const Build_identifiers&) const;
+		Version_data set_build(const Version_data&, Build_identifiers) const;
+		Version_data set_build(Version_data&&, Build_identifiers) const;
 
 		/// Set major version to specified value resetting all lower-priority components to zero/empty values.
 		Version_data reset_major(const Version_data&, const int) const;
@@ -69,10 +212,24 @@ namespace version {
 		Version_data reset_patch(const Version_data&, const int) const;
 
 		/// Set pre-release version to specified value resetting all lower-priority components to zero/empty values.
-		Version_data reset_prerelease(const Version_data&, const Prerelease_identifiers&) const;
+		Version_data reset_prerelease(const Version_data&, Prerelease_identifiers) const;
 
 		/// Set build version to specified value.
-		Version_data reset_build(const Version_data&, const Build_identifiers&) const;
+		Version_data reset_build(const Version_data&, Build_identifiers) const;
+		Version_data reset_build(Version_data&&, Build_identifiers) const;
+
+		/// Packed_version counterparts of the above; prerelease and build are given as dot-separated text,
+		/// which is validated and throws Modification_error if it is not a valid sequence of identifiers.
+		Packed_version set_major(const Packed_version&, const int) const;
+		Packed_version set_minor(const Packed_version&, const int) const;
+		Packed_version set_patch(const Packed_version&, const int) const;
+		Packed_version set_prerelease(const Packed_version&, const String_ref&) const;
+		Packed_version set_build(const Packed_version&, const String_ref&) const;
+		Packed_version reset_major(const Packed_version&, const int) const;
+		Packed_version reset_minor(const Packed_version&, const int) const;
+		Packed_version reset_patch(const Packed_version&, const int) const;
+		Packed_version reset_prerelease(const Packed_version&, const String_ref&) const;
+		Packed_version reset_build(const Packed_version&, const String_ref&) const;
 	};
 
 	/// Concrete version class that binds all semver 2.0.0 functionality together.
@@ -83,6 +240,9 @@ namespace version {
 
 		Semver200_version(const std::string& v)
 			: Basic_version{ v, Semver200_parser(), Semver200_comparator(), Semver200_modifier() } {}
+
+		Semver200_version(const char* v, const std::size_t n)
+			: Basic_version{ v, n, Semver200_parser(), Semver200_comparator(), Semver200_modifier() } {}
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "semver200_stream.h"
+#include "version_column.h"
+
+namespace version {
+
+	/// Options for parse_versions_bulk().
+	struct Bulk_options {
+		/// Number of worker threads; 0 uses all hardware threads.
+		unsigned threads = 0;
+		/// Record delimiter, as for Semver200_stream_parser.
+		char delimiter = '\n';
+		/// Approximate number of input bytes parsed as one task; chunks always end on a record boundary.
+		std::size_t chunk_size = 1 << 20;
+	};
+
+	/// Outcome of parse_versions_bulk(), with valid and invalid records each in input order.
+	struct Bulk_result {
+		Version_column versions; ///< Valid versions.
+		std::vector<std::size_t> lines; ///< 1-based record number of each element of versions.
+		std::vector<Record_error> errors; ///< Invalid records; their texts reference the input buffer.
+		std::size_t records; ///< Number of records in input, counting empty ones.
+	};
+
+	/// Parse delimited version records of an in-memory buffer on several threads.
+	/**
+	Records are interpreted exactly as by Semver200_stream_parser, except that there is no limit on record
+	length. The buffer is split into chunks on record boundaries and every chunk is parsed into its own
+	Version_column by one task. Tasks are scheduled by work stealing: each worker starts with a contiguous
+	range of chunks that it processes front to back, and a worker that runs out takes the back half of the
+	range of another worker. Chunk results are concatenated in input order afterwards, and line numbers and
+	error offsets are rebased to the whole buffer.
+	*/
+	Bulk_result parse_versions_bulk(const char*, const std::size_t, const Bulk_options& = Bulk_options());
+}
@@ -0,0 +1,264 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include "semver200.h"
+
+namespace version {
+
+	/// Table-driven deterministic finite automaton that recognizes semver 2.0.0 version strings.
+	/**
+	Every input byte is mapped to one of a handful of character classes; current state and character class
+	then select a single entry in precomputed transition table. Entry holds the next state and an action:
+	either emit the token that just ended or report an error. Both tables are constant expressions, so the
+	engine allocates nothing by itself - any allocation is done by the sink receiving tokens.
+	*/
+	namespace dfa {
+
+		enum Char_class : unsigned char {
+			c_zero, ///< '0'
+			c_digit, ///< '1' - '9'
+			c_alpha, ///< 'A' - 'Z', 'a' - 'z'
+			c_hyphen, ///< '-'
+			c_dot, ///< '.'
+			c_plus, ///< '+'
+			c_other, ///< anything else
+			c_end, ///< virtual character marking end of input
+			char_classes
+		};
+
+		enum State : unsigned char {
+			s_major, s_major_zero, s_major_num,
+			s_minor, s_minor_zero, s_minor_num,
+			s_patch, s_patch_zero, s_patch_num,
+			// Numeric prerelease identifiers may not have leading 0, but "0", "01a" and "0-1" are fine, so
+			// leading 0 is reported only when identifier ends while still being all digits.
+			s_pre, s_pre_zero, s_pre_lead_zero, s_pre_num, s_pre_alnum,
+			s_build, s_build_id,
+			s_done,
+			states
+		};
+
+		enum Action : unsigned char {
+			a_none,
+			a_major, a_minor, a_patch, ///< emit normal version component
+			a_pre_num, a_pre_alnum, ///< emit prerelease identifier
+			a_build, ///< emit build identifier
+			a_invalid_character, a_leading_zero, a_numeric_leading_zero, a_empty_identifier, a_empty_number,
+			a_unexpected_end
+		};
+
+		struct Transition {
+			State next;
+			Action action;
+		};
+
+		struct Class_table {
+			Char_class classes[256];
+		};
+
+		constexpr Class_table make_class_table() {
+			Class_table t{};
+			for (int c = 0; c < 256; ++c) {
+				Char_class cls = c_other;
+				if (c == '0') cls = c_zero;
+				else if (c >= '1' && c <= '9') cls = c_digit;
+				else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) cls = c_alpha;
+				else if (c == '-') cls = c_hyphen;
+				else if (c == '.') cls = c_dot;
+				else if (c == '+') cls = c_plus;
+				t.classes[c] = cls;
+			}
+			return t;
+		}
+
+		// Tables are static members of a class template so that they can be defined in a header without
+		// violating one definition rule.
+		template<typename = void>
+		struct Tables {
+			static constexpr Class_table classes = make_class_table();
+			static constexpr Transition transitions[states][char_classes] = {
+#define SEMVER_ERR(A) { s_done, A }
+#define SEMVER_INV SEMVER_ERR(a_invalid_character)
+				//           '0'                             '1'-'9'                         alpha                           '-'                             '.'                               '+'                            other      end
+				/* major */ { { s_major_zero, a_none },       { s_major_num, a_none },        SEMVER_INV,                     SEMVER_INV,                     SEMVER_ERR(a_empty_number),       SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* 0     */ { SEMVER_ERR(a_leading_zero),     SEMVER_ERR(a_leading_zero),     SEMVER_INV,                     SEMVER_INV,                     { s_minor, a_major },             SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* num   */ { { s_major_num, a_none },        { s_major_num, a_none },        SEMVER_INV,                     SEMVER_INV,                     { s_minor, a_major },             SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* minor */ { { s_minor_zero, a_none },       { s_minor_num, a_none },        SEMVER_INV,                     SEMVER_INV,                     SEMVER_ERR(a_empty_number),       SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* 0     */ { SEMVER_ERR(a_leading_zero),     SEMVER_ERR(a_leading_zero),     SEMVER_INV,                     SEMVER_INV,                     { s_patch, a_minor },             SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* num   */ { { s_minor_num, a_none },        { s_minor_num, a_none },        SEMVER_INV,                     SEMVER_INV,                     { s_patch, a_minor },             SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_unexpected_end) },
+				/* patch */ { { s_patch_zero, a_none },       { s_patch_num, a_none },        SEMVER_INV,                     SEMVER_ERR(a_empty_number),     SEMVER_INV,                       SEMVER_ERR(a_empty_number),    SEMVER_INV, SEMVER_ERR(a_empty_number) },
+				/* 0     */ { SEMVER_ERR(a_leading_zero),     SEMVER_ERR(a_leading_zero),     SEMVER_INV,                     { s_pre, a_patch },             SEMVER_INV,                       { s_build, a_patch },          SEMVER_INV, { s_done, a_patch } },
+				/* num   */ { { s_patch_num, a_none },        { s_patch_num, a_none },        SEMVER_INV,                     { s_pre, a_patch },             SEMVER_INV,                       { s_build, a_patch },          SEMVER_INV, { s_done, a_patch } },
+				/* pre   */ { { s_pre_zero, a_none },         { s_pre_num, a_none },          { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        SEMVER_ERR(a_empty_identifier),   SEMVER_ERR(a_empty_identifier),SEMVER_INV, SEMVER_ERR(a_empty_identifier) },
+				/* 0     */ { { s_pre_lead_zero, a_none },    { s_pre_lead_zero, a_none },    { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        { s_pre, a_pre_num },             { s_build, a_pre_num },        SEMVER_INV, { s_done, a_pre_num } },
+				/* 0dd   */ { { s_pre_lead_zero, a_none },    { s_pre_lead_zero, a_none },    { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        SEMVER_ERR(a_numeric_leading_zero), SEMVER_ERR(a_numeric_leading_zero), SEMVER_INV, SEMVER_ERR(a_numeric_leading_zero) },
+				/* num   */ { { s_pre_num, a_none },          { s_pre_num, a_none },          { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        { s_pre, a_pre_num },             { s_build, a_pre_num },        SEMVER_INV, { s_done, a_pre_num } },
+				/* alnum */ { { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        { s_pre_alnum, a_none },        { s_pre, a_pre_alnum },           { s_build, a_pre_alnum },      SEMVER_INV, { s_done, a_pre_alnum } },
+				/* build */ { { s_build_id, a_none },         { s_build_id, a_none },         { s_build_id, a_none },         { s_build_id, a_none },         SEMVER_ERR(a_empty_identifier),   SEMVER_INV,                    SEMVER_INV, SEMVER_ERR(a_empty_identifier) },
+				/* id    */ { { s_build_id, a_none },         { s_build_id, a_none },         { s_build_id, a_none },         { s_build_id, a_none },         { s_build, a_build },             SEMVER_INV,                    SEMVER_INV, { s_done, a_build } },
+				/* done  */ { SEMVER_INV,                     SEMVER_INV,                     SEMVER_INV,                     SEMVER_INV,                     SEMVER_INV,                       SEMVER_INV,                    SEMVER_INV, SEMVER_INV }
+#undef SEMVER_INV
+#undef SEMVER_ERR
+			};
+		};
+
+		template<typename T>
+		constexpr Class_table Tables<T>::classes;
+
+		template<typename T>
+		constexpr Transition Tables<T>::transitions[states][char_classes];
+
+		/// Outcome of scanning a version string: error code and offset of the byte where error was detected.
+		struct Scan_status {
+			Parse_errc code;
+			std::size_t offset;
+		};
+
+		/// Convert digits of already validated normal version component to int, detecting overflow.
+		constexpr bool to_int(const char* b, const char* e, int& out) {
+			long long v = 0;
+			for (; b != e; ++b) {
+				v = v * 10 + (*b - '0');
+				if (v > INT_MAX) return false;
+			}
+			out = static_cast<int>(v);
+			return true;
+		}
+
+		/// Map error action from transition table to error code.
+		constexpr Parse_errc to_errc(const Action a) {
+			return a == a_invalid_character ? Parse_errc::invalid_character
+				: a == a_leading_zero ? Parse_errc::leading_zero
+				: a == a_numeric_leading_zero ? Parse_errc::numeric_leading_zero
+				: a == a_empty_identifier ? Parse_errc::empty_identifier
+				: a == a_empty_number ? Parse_errc::empty_number
+				: Parse_errc::unexpected_end;
+		}
+
+		/// Return true if character may appear inside prerelease or build identifier.
+		constexpr bool is_identifier_char(const char c) {
+			return Tables<>::classes.classes[static_cast<unsigned char>(c)] <= c_hyphen;
+		}
+
+		/// Instruction set used to skip over runs of identifier characters.
+		enum class Simd_level {
+			scalar, ///< One character at a time, usable in constant expressions
+			sse2, ///< 16 characters at a time
+			avx2 ///< 32 characters at a time
+		};
+
+		/// Best instruction set supported by the CPU the code is running on.
+		Simd_level simd_level();
+
+		/// Find first character in [b, e) that cannot appear inside identifier, using the best supported
+		/// instruction set; return e if there is none.
+		const char* skip_identifier_chars(const char* b, const char* e);
+
+		/// Find first non-identifier character using given instruction set, or scalar code if it is not supported.
+		const char* skip_identifier_chars(const char* b, const char* e, const Simd_level);
+
+		/// Skipper that checks one character at a time; usable in constant expressions.
+		struct Scalar_skipper {
+			static constexpr const char* skip(const char* b, const char* e) {
+				while (b != e && is_identifier_char(*b)) ++b;
+				return b;
+			}
+		};
+
+		/// Skipper that classifies whole vectors of characters at once, selected at runtime.
+		struct Simd_skipper {
+			static const char* skip(const char* b, const char* e) {
+				return skip_identifier_chars(b, e);
+			}
+		};
+
+		/// Run the automaton over [s, s + n) and pass recognized tokens to sink.
+		/**
+		Sink must provide following member functions:
+		- normal(int component, int value), where component is 0 for major, 1 for minor and 2 for patch;
+		- prerelease(const char* begin, const char* end, Id_type type);
+		- build(const char* begin, const char* end).
+
+		In states where any identifier character keeps the automaton in the same state (inside alphanumeric
+		prerelease identifier or build identifier), Skipper is used to jump over the whole run of such
+		characters at once instead of stepping through the table.
+
+		Scanning stops at the first error; tokens emitted up to that point are not retracted.
+		*/
+		template<typename Skipper, typename Sink>
+		constexpr Scan_status basic_scan(const char* s, const std::size_t n, Sink& sink) {
+			State state = s_major;
+			std::size_t token = 0;
+			for (std::size_t i = 0; i <= n; ++i) {
+				const Char_class cls = i < n ? Tables<>::classes.classes[static_cast<unsigned char>(s[i])] : c_end;
+				const Transition t = Tables<>::transitions[state][cls];
+				switch (t.action) {
+				case a_none:
+					break;
+				case a_major:
+				case a_minor:
+				case a_patch: {
+					int value = 0;
+					if (!to_int(s + token, s + i, value)) return Scan_status{ Parse_errc::out_of_range, token };
+					sink.normal(t.action - a_major, value);
+					token = i + 1;
+					break;
+				}
+				case a_pre_num:
+					sink.prerelease(s + token, s + i, Id_type::num);
+					token = i + 1;
+					break;
+				case a_pre_alnum:
+					sink.prerelease(s + token, s + i, Id_type::alnum);
+					token = i + 1;
+					break;
+				case a_build:
+					sink.build(s + token, s + i);
+					token = i + 1;
+					break;
+				case a_numeric_leading_zero:
+					// Leading 0 is detected only at the end of identifier; report the identifier itself.
+					return Scan_status{ Parse_errc::numeric_leading_zero, token };
+				default:
+					return Scan_status{ to_errc(t.action), i };
+				}
+				state = t.next;
+				if ((state == s_pre_alnum || state == s_build_id) && i < n) {
+					i = static_cast<std::size_t>(Skipper::skip(s + i + 1, s + n) - s) - 1;
+				}
+			}
+			return Scan_status{ Parse_errc::ok, n };
+		}
+
+		/// Run the automaton using the fastest identifier skipper available at runtime.
+		template<typename Sink>
+		Scan_status scan(const char* s, const std::size_t n, Sink& sink) {
+			return basic_scan<Simd_skipper>(s, n, sink);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include "semver200.h"
+
+namespace version {
+
+	/// Hash consistent with semver 2.0.0 precedence: versions that compare equal get equal hashes.
+	/**
+	Build metadata is ignored and numeric prerelease identifiers are hashed by value, so hand-made
+	identifiers with leading zeros hash like their canonical form. Use together with Semver200_equal.
+	*/
+	struct Semver200_hash {
+		std::size_t operator()(const Version_data&) const;
+		std::size_t operator()(const Semver200_version& v) const { return (*this)(v.data()); }
+	};
+
+	/// Equality of semver 2.0.0 precedence, for unordered containers of Version_data.
+	struct Semver200_equal {
+		bool operator()(const Version_data& l, const Version_data& r) const {
+			return Semver200_comparator().compare(l, r) == 0;
+		}
+		bool operator()(const Semver200_version& l, const Semver200_version& r) const {
+			return (*this)(l.data(), r.data());
+		}
+	};
+
+	/// Hash of exact version identity, including build metadata and identifier text as written.
+	/**
+	Use together with Semver200_exact_equal, e.g. to deduplicate versions that differ only in build metadata.
+	*/
+	struct Semver200_exact_hash {
+		std::size_t operator()(const Version_data&) const;
+		std::size_t operator()(const Semver200_version& v) const { return (*this)(v.data()); }
+	};
+
+	/// Exact version identity: all components, including build metadata, are equal.
+	struct Semver200_exact_equal {
+		bool operator()(const Version_data& l, const Version_data& r) const {
+			return l.major == r.major && l.minor == r.minor && l.patch == r.patch
+				&& l.prerelease_ids == r.prerelease_ids && l.build_ids == r.build_ids;
+		}
+		bool operator()(const Semver200_version& l, const Semver200_version& r) const {
+			return (*this)(l.data(), r.data());
+		}
+	};
+
+	/// Semver200_version with its precedence hash computed once, for tables that rehash or probe often.
+	class Semver200_hashed_version {
+	public:
+		explicit Semver200_hashed_version(Semver200_version v) : version_{ std::move(v) }, hash_{ Semver200_hash()(version_) } {}
+
+		const Semver200_version& version() const { return version_; }
+		std::size_t hash() const { return hash_; }
+
+	private:
+		Semver200_version version_;
+		std::size_t hash_;
+	};
+
+	/// Versions are equal if they have equal precedence; cached hashes are compared first.
+	inline bool operator==(const Semver200_hashed_version& l, const Semver200_hashed_version& r) {
+		return l.hash() == r.hash() && l.version() == r.version();
+	}
+
+	inline bool operator!=(const Semver200_hashed_version& l, const Semver200_hashed_version& r) {
+		return !(l == r);
+	}
+}
+
+namespace std {
+
+	/// Precedence-consistent hash, matching operator== of Semver200_version.
+	template<>
+	struct hash<version::Semver200_version> {
+		size_t operator()(const version::Semver200_version& v) const {
+			return version::Semver200_hash()(v);
+		}
+	};
+
+	/// Cached precedence-consistent hash.
+	template<>
+	struct hash<version::Semver200_hashed_version> {
+		size_t operator()(const version::Semver200_hashed_version& v) const {
+			return v.hash();
+		}
+	};
+}
@@ -0,0 +1,132 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "epoch_domain.h"
+#include "semver200.h"
+
+namespace version {
+
+	/// Highest and highest stable version published so far, updated by many threads without locks.
+	/**
+	Each published maximum is an immutable snapshot referenced by an atomic pointer. A writer that sees a
+	higher version allocates a snapshot and installs it with compare-and-swap, retrying while other writers
+	install higher versions concurrently; a version that is not higher than the current snapshot is rejected
+	without allocating. Readers only load the pointer, so they never block or retry.
+
+	Superseded snapshots are reclaimed through an Epoch_domain: readers and writers hold a read guard while
+	they look at a snapshot, and a snapshot is freed by a later publish once nobody can see it any more.
+	Versions are returned as shared pointers that stay valid for as long as they are held; taking one is an
+	atomic increment of a count shared by all readers of the version, but never a lock. Of versions with equal
+	precedence, i.e. differing only in build metadata, the first one published is kept.
+	*/
+	class Semver200_latest_version {
+	public:
+		/// Construct tracker with an epoch domain of its own.
+		Semver200_latest_version();
+
+		/// Construct tracker that reclaims snapshots through the given domain, which must outlive it.
+		explicit Semver200_latest_version(Epoch_domain&);
+
+		Semver200_latest_version(const Semver200_latest_version&) = delete;
+		Semver200_latest_version& operator=(const Semver200_latest_version&) = delete;
+		~Semver200_latest_version();
+
+		/// Publish version; returns true if it became the highest or the highest stable version.
+		bool publish(const Semver200_version&);
+
+		/// Highest published version, nullptr if nothing was published.
+		std::shared_ptr<const Semver200_version> latest() const;
+
+		/// Highest published version without prerelease identifiers, nullptr if there is none.
+		std::shared_ptr<const Semver200_version> latest_stable() const;
+
+	private:
+		/// Published version; it owns itself through self until it is reclaimed, and readers share that ownership.
+		struct Snapshot {
+			explicit Snapshot(const Semver200_version& v) : version(v), epoch{ 0 }, next_retired{ nullptr } {}
+
+			Semver200_version version;
+			std::uint64_t epoch; ///< Epoch the snapshot was retired in.
+			Snapshot* next_retired;
+			std::shared_ptr<Snapshot> self;
+		};
+
+		std::shared_ptr<const Semver200_version> load(const std::atomic<Snapshot*>&) const;
+		bool raise(std::atomic<Snapshot*>&, const Semver200_version&);
+		void retire(Snapshot*);
+		void reclaim();
+
+		std::unique_ptr<Epoch_domain> own_domain_;
+		Epoch_domain* domain_;
+		std::atomic<Snapshot*> latest_;
+		std::atomic<Snapshot*> stable_;
+		std::atomic<Snapshot*> retired_; ///< Lock-free stack of superseded snapshots.
+	};
+
+	/// Semver200_latest_version per key, e.g. per package name.
+	/**
+	Keys are kept in an insert-only hash table with a fixed number of buckets, each a lock-free linked list:
+	a new key is pushed onto its bucket with compare-and-swap and keys are never removed, so lookups traverse
+	the lists without locks. Bucket count should be in the order of the expected number of keys.
+	*/
+	class Semver200_latest_tracker {
+	public:
+		explicit Semver200_latest_tracker(const std::size_t buckets = 1024);
+		Semver200_latest_tracker(const Semver200_latest_tracker&) = delete;
+		Semver200_latest_tracker& operator=(const Semver200_latest_tracker&) = delete;
+		~Semver200_latest_tracker();
+
+		/// Publish version under key; returns true if it became the highest or highest stable version of key.
+		bool publish(const std::string& key, const Semver200_version&);
+
+		/// Highest version published under key, nullptr if there is none.
+		std::shared_ptr<const Semver200_version> latest(const std::string& key) const;
+
+		/// Highest stable version published under key, nullptr if there is none.
+		std::shared_ptr<const Semver200_version> latest_stable(const std::string& key) const;
+
+	private:
+		struct Entry {
+			Entry(const std::string& k, Epoch_domain& d) : key(k), versions(d), next{ nullptr } {}
+
+			std::string key;
+			Semver200_latest_version versions;
+			Entry* next;
+		};
+
+		std::atomic<Entry*>& bucket(const std::string&) const;
+		Entry* find(const std::string&) const;
+
+		Epoch_domain domain_; ///< Shared by versions of all keys.
+		std::unique_ptr<std::atomic<Entry*>[]> buckets_;
+		std::size_t bucket_count_;
+	};
+}
@@ -0,0 +1,111 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "semver200.h"
+
+namespace version {
+
+	/// Semver 2.0.0 version that keeps its source text and splits identifiers only on demand.
+	/**
+	Construction validates the text with the parser automaton and decodes major, minor and patch, but
+	only records where prerelease and build parts start instead of splitting them into separately
+	allocated identifiers; the text itself, held in a std::string, is the only allocation (none at all when
+	the text fits the standard library's small string buffer, which is implementation-defined).
+	Comparisons look at the numeric triple first and walk prerelease text only when the triples are equal.
+	Streaming a lazy version writes the original text as is.
+	*/
+	class Semver200_lazy_version {
+	public:
+		/// Construct version 0.0.0.
+		Semver200_lazy_version();
+
+		/// Construct version from string; throws Parse_error if it is not a valid version.
+		explicit Semver200_lazy_version(std::string);
+
+		/// Construct version from a range of characters; throws Parse_error if it is not a valid version.
+		Semver200_lazy_version(const char*, const std::size_t);
+
+		int major() const { return major_; } ///< Get major version.
+		int minor() const { return minor_; } ///< Get minor version.
+		int patch() const { return patch_; } ///< Get patch version.
+		std::string prerelease() const { return prerelease_text().str(); } ///< Get prerelease version string.
+		std::string build() const { return build_text().str(); } ///< Get build version string.
+
+		/// Prerelease text within the source, without leading '-'; does not allocate.
+		String_ref prerelease_text() const {
+			return String_ref(text_.data() + prerelease_, prerelease_size_);
+		}
+
+		/// Build text within the source, without leading '+'; does not allocate.
+		String_ref build_text() const {
+			return String_ref(text_.data() + build_, text_.size() - build_);
+		}
+
+		/// Original version text.
+		const std::string& str() const { return text_; }
+
+		/// Borrowed view of the version; valid until this object is modified or destroyed.
+		Version_view view() const {
+			return Version_view{ major_, minor_, patch_, prerelease_text(), build_text() };
+		}
+
+		/// Split identifiers into self-contained Version_data.
+		Version_data data() const { return view().to_data(); }
+
+		/// Convert to eagerly parsed version object.
+		Semver200_version version() const { return Semver200_version(text_); }
+
+	private:
+		void init();
+
+		std::string text_;
+		int major_;
+		int minor_;
+		int patch_;
+		std::uint32_t prerelease_; ///< Offset of prerelease text.
+		std::uint32_t prerelease_size_; ///< Length of prerelease text, 0 if there is none.
+		std::uint32_t build_; ///< Offset of build text, text size if there is none.
+	};
+
+	/// Compare lazy versions using semantic versioning 2.0.0 rules.
+	int compare(const Semver200_lazy_version&, const Semver200_lazy_version&);
+
+	inline bool operator==(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) == 0; }
+	inline bool operator!=(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) != 0; }
+	inline bool operator<(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) < 0; }
+	inline bool operator>(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) > 0; }
+	inline bool operator<=(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) <= 0; }
+	inline bool operator>=(const Semver200_lazy_version& l, const Semver200_lazy_version& r) { return compare(l, r) >= 0; }
+
+	/// Output original version text.
+	inline std::ostream& operator<<(std::ostream& os, const Semver200_lazy_version& v) {
+		return os.write(v.str().data(), static_cast<std::streamsize>(v.str().size()));
+	}
+}
@@ -0,0 +1,188 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include "semver200.h"
+#include "semver200_dfa.h"
+#include "semver200_precedence.h"
+#include "version_view.h"
+
+namespace version {
+
+	namespace detail {
+
+		/// Records boundaries of prerelease and build text; usable in constant expressions.
+		struct Literal_sink {
+			constexpr Literal_sink()
+				: normal_ids{ 0, 0, 0 }, prerelease_begin{ nullptr }, prerelease_end{ nullptr },
+				build_begin{ nullptr }, build_end{ nullptr } {}
+
+			constexpr void normal(const int component, const int value) {
+				normal_ids[component] = value;
+			}
+
+			constexpr void prerelease(const char* b, const char* e, const Id_type) {
+				if (!prerelease_begin) prerelease_begin = b;
+				prerelease_end = e;
+			}
+
+			constexpr void build(const char* b, const char* e) {
+				if (!build_begin) build_begin = b;
+				build_end = e;
+			}
+
+			int normal_ids[3];
+			const char* prerelease_begin;
+			const char* prerelease_end;
+			const char* build_begin;
+			const char* build_end;
+		};
+
+		constexpr String_ref make_ref(const char* b, const char* e) {
+			return b ? String_ref(b, static_cast<std::size_t>(e - b)) : String_ref();
+		}
+
+		/// Parse version with the scalar automaton; throwing makes invalid literals fail to compile.
+		constexpr Version_view parse_literal(const char* s, const std::size_t n) {
+			Literal_sink sink;
+			const dfa::Scan_status status = dfa::basic_scan<dfa::Scalar_skipper>(s, n, sink);
+			if (status.code != Parse_errc::ok) {
+				throw Parse_error(error_message(Parse_status{ status.code, status.offset,
+					status.offset < n ? s[status.offset] : '\0' }));
+			}
+			return Version_view{ sink.normal_ids[0], sink.normal_ids[1], sink.normal_ids[2],
+				make_ref(sink.prerelease_begin, sink.prerelease_end), make_ref(sink.build_begin, sink.build_end) };
+		}
+
+		/// Get identifier starting at pos within dot-separated text and move pos past it; more is cleared
+		/// when the last identifier has been taken.
+		constexpr String_ref next_identifier(const String_ref& text, std::size_t& pos, bool& more) {
+			const std::size_t start = pos;
+			while (pos < text.size && text.data[pos] != '.') ++pos;
+			const String_ref id(text.data + start, pos - start);
+			more = pos < text.size;
+			if (more) ++pos;
+			return id;
+		}
+	}
+
+	/// Version constant parsed and validated at compile time.
+	/**
+	Literal references the characters it was created from, which for string literals have static storage
+	duration, so it needs no initialization at run time. Validation rules are those of Semver200_parser; in a
+	constant expression an invalid version fails to compile, at run time Parse_error is thrown.
+	Literals compare with each other in constant expressions and with Semver200_version objects at run time.
+	*/
+	class Semver200_literal {
+	public:
+		constexpr Semver200_literal(const char* s, const std::size_t n)
+			: text_{ s, n }, view_{ detail::parse_literal(s, n) } {}
+
+		constexpr int major() const { return view_.major; } ///< Get major version.
+		constexpr int minor() const { return view_.minor; } ///< Get minor version.
+		constexpr int patch() const { return view_.patch; } ///< Get patch version.
+		constexpr String_ref prerelease() const { return view_.prerelease; } ///< Get prerelease text.
+		constexpr String_ref build() const { return view_.build; } ///< Get build text.
+		constexpr String_ref str() const { return text_; } ///< Get complete version text.
+
+		/// Get borrowed view of the version.
+		constexpr const Version_view& view() const { return view_; }
+
+		/// Create runtime version object with the same value.
+		Semver200_version version() const { return Semver200_version(text_.data, text_.size); }
+
+	private:
+		String_ref text_;
+		Version_view view_;
+	};
+
+	/// Compare literals using semantic versioning 2.0.0 rules; usable in constant expressions.
+	constexpr int compare(const Semver200_literal& l, const Semver200_literal& r) {
+		int cmp = detail::compare_normal(l.view(), r.view());
+		if (cmp != 0) return cmp;
+		const String_ref lp = l.prerelease();
+		const String_ref rp = r.prerelease();
+		if (lp.empty() != rp.empty()) return lp.empty() ? 1 : -1;
+		std::size_t li = 0, ri = 0;
+		bool lmore = !lp.empty(), rmore = !rp.empty();
+		while (lmore && rmore) {
+			const String_ref a = detail::next_identifier(lp, li, lmore);
+			const String_ref b = detail::next_identifier(rp, ri, rmore);
+			cmp = detail::compare_identifiers(a, identifier_type(a), b, identifier_type(b));
+			if (cmp != 0) return cmp;
+		}
+		if (lmore == rmore) return 0;
+		return lmore ? 1 : -1;
+	}
+
+	/// Compare literal with parsed version using semantic versioning 2.0.0 rules.
+	inline int compare(const Semver200_literal& l, const Version_data& r) {
+		int cmp = detail::compare_normal(l.view(), r);
+		if (cmp != 0) return cmp;
+		const String_ref lp = l.prerelease();
+		if (lp.empty() != r.prerelease_ids.empty()) return lp.empty() ? 1 : -1;
+		std::size_t li = 0, ri = 0;
+		bool lmore = !lp.empty();
+		for (; lmore && ri < r.prerelease_ids.size(); ++ri) {
+			const String_ref a = detail::next_identifier(lp, li, lmore);
+			const auto& b = r.prerelease_ids[ri];
+			cmp = detail::compare_identifiers(a, identifier_type(a), String_ref(b.first), b.second);
+			if (cmp != 0) return cmp;
+		}
+		const bool rmore = ri < r.prerelease_ids.size();
+		if (lmore == rmore) return 0;
+		return lmore ? 1 : -1;
+	}
+
+	constexpr bool operator==(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) == 0; }
+	constexpr bool operator!=(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) != 0; }
+	constexpr bool operator<(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) < 0; }
+	constexpr bool operator>(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) > 0; }
+	constexpr bool operator<=(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) <= 0; }
+	constexpr bool operator>=(const Semver200_literal& l, const Semver200_literal& r) { return compare(l, r) >= 0; }
+
+	inline bool operator==(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) == 0; }
+	inline bool operator!=(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) != 0; }
+	inline bool operator<(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) < 0; }
+	inline bool operator>(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) > 0; }
+	inline bool operator<=(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) <= 0; }
+	inline bool operator>=(const Semver200_literal& l, const Semver200_version& r) { return compare(l, r.data()) >= 0; }
+
+	inline bool operator==(const Semver200_version& l, const Semver200_literal& r) { return r == l; }
+	inline bool operator!=(const Semver200_version& l, const Semver200_literal& r) { return r != l; }
+	inline bool operator<(const Semver200_version& l, const Semver200_literal& r) { return r > l; }
+	inline bool operator>(const Semver200_version& l, const Semver200_literal& r) { return r < l; }
+	inline bool operator<=(const Semver200_version& l, const Semver200_literal& r) { return r >= l; }
+	inline bool operator>=(const Semver200_version& l, const Semver200_literal& r) { return r <= l; }
+
+	namespace literals {
+
+		/// Create version constant from string literal, e.g. "1.2.3-rc.1"_semver.
+		constexpr Semver200_literal operator"" _semver(const char* s, const std::size_t n) {
+			return Semver200_literal(s, n);
+		}
+	}
+}
@@ -0,0 +1,81 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include "version.h"
+#include "version_view.h"
+
+namespace version {
+
+	namespace detail {
+
+		/// Compare characters as unsigned bytes; shorter text that is a prefix of the other is lower.
+		constexpr int compare_chars(const String_ref& l, const String_ref& r) {
+			for (std::size_t i = 0; i < l.size && i < r.size; ++i) {
+				const unsigned char a = static_cast<unsigned char>(l.data[i]);
+				const unsigned char b = static_cast<unsigned char>(r.data[i]);
+				if (a != b) return a < b ? -1 : 1;
+			}
+			if (l.size == r.size) return 0;
+			return l.size < r.size ? -1 : 1;
+		}
+
+		/// Skip leading zeros of numeric identifier; parsed identifiers have none, but hand-made ones might.
+		constexpr String_ref strip_leading_zeros(String_ref id) {
+			while (id.size > 1 && id.data[0] == '0') {
+				++id.data;
+				--id.size;
+			}
+			return id;
+		}
+
+		/// Compare numeric identifiers of any length without converting them: longer number has greater value
+		/// and numbers of equal length compare as strings.
+		constexpr int compare_numeric(const String_ref& l, const String_ref& r) {
+			const String_ref ln = strip_leading_zeros(l);
+			const String_ref rn = strip_leading_zeros(r);
+			if (ln.size != rn.size) return ln.size < rn.size ? -1 : 1;
+			return compare_chars(ln, rn);
+		}
+
+		/// Compare prerelease identifiers of given types; numeric identifiers have lower precedence.
+		constexpr int compare_identifiers(const String_ref& l, const Id_type lt, const String_ref& r,
+			const Id_type rt) {
+			if (lt != rt) return lt == Id_type::alnum ? 1 : -1;
+			return lt == Id_type::num ? compare_numeric(l, r) : compare_chars(l, r);
+		}
+
+		/// Compare normal version components of any two version representations.
+		template<typename L, typename R>
+		constexpr int compare_normal(const L& l, const R& r) {
+			if (l.major != r.major) return l.major < r.major ? -1 : 1;
+			if (l.minor != r.minor) return l.minor < r.minor ? -1 : 1;
+			if (l.patch != r.patch) return l.patch < r.patch ? -1 : 1;
+			return 0;
+		}
+	}
+}
@@ -0,0 +1,98 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "semver200.h"
+
+namespace version {
+
+	/// Contiguous interval of versions [lower, upper) in semver 2.0.0 precedence order.
+	/**
+	Inclusive upper bounds and exclusive lower bounds are normalized away by replacing the bound with its
+	immediate successor: the successor of release X.Y.Z is X.Y.(Z+1)-0, and the successor of prerelease X.Y.Z-P
+	is X.Y.Z-P.0. Missing bound means the interval is unbounded on that side.
+
+	Prerelease versions are only matched if they share major, minor and patch with a bound that came from a
+	comparator with a prerelease (e.g. ">=1.2.3-beta" admits 1.2.3-rc but not 1.2.4-rc), as npm does.
+	*/
+	struct Version_interval {
+		Version_interval();
+
+		Version_data lower; ///< Lowest version in the interval.
+		Version_data upper; ///< Lowest version above the interval.
+		bool has_lower; ///< False if interval has no lower bound.
+		bool has_upper; ///< False if interval has no upper bound.
+		bool lower_prerelease; ///< Prereleases with the same major.minor.patch as lower are admitted.
+		bool upper_prerelease; ///< Prereleases with the same major.minor.patch as upper are admitted.
+
+		/// Test if version lies within bounds, ignoring prerelease admission rules.
+		bool contains(const Version_data&) const;
+
+		/// Test if prerelease version is admitted by a bound; release versions always are.
+		bool admits_prerelease(const Version_data&) const;
+	};
+
+	/// Set of versions described by npm/Cargo-style constraint expression.
+	/**
+	Expression is a "||"-separated union of comparator sets; comparators within a set are separated by
+	whitespace or commas and all of them must be satisfied. Supported comparators:
+	- primitives: "<", "<=", ">", ">=", "=" followed by a (possibly partial) version;
+	- bare versions: "1.2.3" matches exactly, partial "1.2" and x-ranges "1.x", "1.2.*", "*" match anything
+	with the given prefix;
+	- tilde ranges: "~1.2.3" (also "~>1.2.3") allows patch-level changes;
+	- caret ranges: "^1.2.3" allows changes that do not modify the left-most non-zero component;
+	- hyphen ranges: "1.2.3 - 2.3.4" is inclusive on both ends.
+
+	Bare versions follow npm semantics (exact match), not Cargo's implicit caret. Versions may be prefixed with
+	"v" and build metadata is ignored. Expression is compiled once into a list of Version_interval objects;
+	satisfies() then needs no allocation and at most two comparisons per interval.
+	*/
+	class Semver200_range {
+	public:
+		/// Compile constraint expression; throws Parse_error if it is malformed.
+		/**
+		If include_prerelease is set, prerelease versions are matched like any other version.
+		*/
+		explicit Semver200_range(const std::string&, const bool include_prerelease = false);
+
+		/// Test if version belongs to the range.
+		bool satisfies(const Version_data&) const;
+
+		/// Test if version belongs to the range.
+		bool satisfies(const Semver200_version&) const;
+
+		/// Intervals the range consists of; empty intervals are dropped.
+		const std::vector<Version_interval>& intervals() const { return intervals_; }
+
+		/// Test if prerelease versions are matched without restrictions.
+		bool include_prerelease() const { return include_prerelease_; }
+
+	private:
+		std::vector<Version_interval> intervals_;
+		bool include_prerelease_;
+	};
+}
@@ -0,0 +1,117 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "semver200_range.h"
+
+namespace version {
+
+	/// Reverse index over many ranges: finds all ranges satisfied by a given version.
+	/**
+	Every interval of every indexed range becomes one entry whose bounds are stored as precedence keys of
+	Semver200_key_codec, so bounds are compared with memcmp in semver 2.0.0 precedence order. Entries are kept
+	sorted by lower bound, and a segment tree over them records the entry with the highest upper bound in every
+	subtree. A query finds the prefix of entries starting at or below the version with one binary search and then
+	descends only into subtrees whose highest upper bound lies above the version, giving O(log n + k log n) time
+	for k matches instead of a scan over all ranges.
+
+	Insertion and removal work in batches: each call re-sorts and rebuilds the tree once in O(n + b log b) for
+	a batch of b ranges, so changes should be grouped where possible.
+	*/
+	class Semver200_range_index {
+	public:
+		/// Caller-supplied identifier of an indexed range.
+		using Id = std::size_t;
+
+		Semver200_range_index();
+
+		/// Add single range under given identifier.
+		/**
+		A range inserted under an identifier that is already present is added to the ranges of that identifier.
+		*/
+		void insert(const Id, const Semver200_range&);
+
+		/// Add batch of ranges given as a sequence of (Id, Semver200_range) pairs.
+		template<typename It>
+		void insert(It first, It last) {
+			const std::size_t old_size = entries_.size();
+			for (; first != last; ++first) append(first->first, first->second);
+			commit(old_size);
+		}
+
+		/// Remove all intervals of range with given identifier.
+		void erase(const Id);
+
+		/// Remove batch of ranges given as a sequence of identifiers.
+		template<typename It>
+		void erase(It first, It last) {
+			erase_ids(std::vector<Id>(first, last));
+		}
+
+		/// Find identifiers of all ranges satisfied by version; each identifier is reported once, in no particular order.
+		std::vector<Id> find(const Version_data&) const;
+
+		/// Append identifiers of all ranges satisfied by version to the given vector.
+		void find(const Version_data&, std::vector<Id>&) const;
+
+		/// Number of indexed intervals; range consisting of several intervals is counted several times.
+		std::size_t size() const { return entries_.size(); }
+
+		/// Test if index is empty.
+		bool empty() const { return entries_.empty(); }
+
+		/// Remove all ranges.
+		void clear();
+
+	private:
+		struct Entry {
+			std::string lower; ///< Precedence key of lower bound, empty if unbounded.
+			std::string upper; ///< Precedence key of upper bound, meaningful only if has_upper is set.
+			Id id;
+			int lower_normal[3];
+			int upper_normal[3];
+			bool has_upper;
+			bool lower_prerelease;
+			bool upper_prerelease;
+			bool include_prerelease;
+		};
+
+		void append(const Id, const Semver200_range&);
+		void commit(const std::size_t);
+		void erase_ids(std::vector<Id>);
+		void build(const std::size_t, const std::size_t, const std::size_t);
+		void collect(const std::size_t, const std::size_t, const std::size_t, const std::size_t, const std::string&,
+			const Version_data&, std::vector<Id>&) const;
+
+		std::vector<Entry> entries_;
+		std::vector<std::size_t> tree_; ///< Index of entry with highest upper bound in each subtree.
+		std::unordered_map<Id, std::size_t> entry_counts_; ///< Number of entries per identifier.
+		std::size_t shared_ids_; ///< Identifiers with several entries; results need deduplication if nonzero.
+	};
+}
@@ -0,0 +1,137 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "epoch_domain.h"
+#include "semver200.h"
+#include "semver200_range.h"
+
+namespace version {
+
+	/// Map from package name to its versions in precedence order, for many concurrent readers and few writers.
+	/**
+	Readers work on immutable snapshots in the manner of RCU: versions of a package are held in a vector that
+	is never modified once published through a plain atomic pointer. A writer builds a new vector with the
+	inserted versions and swaps the pointer; readers only load it, so they neither lock nor retry. Snapshots
+	returned to callers are reference counted and stay valid as long as they are held; taking one is an
+	atomic increment of a count shared by all readers of the package, but never a lock.
+
+	Superseded pointers are reclaimed through an Epoch_domain: a reader holds a read guard while it looks a
+	package up, and writers free what they replaced once all readers that could still see it have left.
+	Freeing is done by later writes to the same shard, so a few replaced snapshots may be kept until then or
+	until the registry is destroyed.
+
+	Packages are distributed over shards by hash of their name. Writers to packages in different shards do not
+	contend; writers within a shard are serialized by the shard's mutex, which readers never take. Each shard
+	finds packages in an insert-only open addressing table: a new package is stored into a free slot without
+	copying the others, and the table is replaced by one of twice the size when it gets half full, which
+	copies only pointers to the packages.
+
+	Versions of equal precedence that differ in build metadata are all kept, in insertion order; inserting a
+	version identical to a present one, build metadata included, has no effect.
+	*/
+	class Semver200_registry {
+	public:
+		/// Versions of a package in ascending precedence order.
+		using Versions = std::vector<Semver200_version>;
+
+		/// Immutable snapshot of versions of a package.
+		using Snapshot = std::shared_ptr<const Versions>;
+
+		explicit Semver200_registry(const std::size_t shards = 16);
+		Semver200_registry(const Semver200_registry&) = delete;
+		Semver200_registry& operator=(const Semver200_registry&) = delete;
+		~Semver200_registry();
+
+		/// Add version to package; returns false if an identical version is already present.
+		bool insert(const std::string& package, const Semver200_version&);
+
+		/// Add sequence of versions to package, publishing a single new snapshot; returns number of versions added.
+		template<typename It>
+		std::size_t insert(const std::string& package, It first, It last) {
+			return insert_batch(package, Versions(first, last));
+		}
+
+		/// Current versions of package; snapshot is empty if package is unknown.
+		Snapshot versions(const std::string& package) const;
+
+		/// Highest version of package satisfying the range, nullptr if there is none.
+		/**
+		Returned pointer shares ownership of the snapshot the version was found in.
+		*/
+		std::shared_ptr<const Semver200_version> max_satisfying(const std::string& package,
+			const Semver200_range&) const;
+
+	private:
+		struct Package {
+			Package(const std::string& n, const std::size_t h) : name(n), hash{ h }, versions{ nullptr } {}
+			~Package() { delete versions.load(); }
+
+			std::string name;
+			std::size_t hash;
+			std::atomic<const Snapshot*> versions; ///< Never null once the package is in a table.
+		};
+
+		struct Table {
+			explicit Table(const std::size_t capacity);
+
+			std::size_t mask; ///< Capacity minus one; capacity is a power of two.
+			std::size_t size;
+			std::unique_ptr<std::atomic<Package*>[]> slots;
+		};
+
+		/// Replaced object waiting for readers of the epoch it was retired in to leave.
+		struct Retired {
+			std::uint64_t epoch;
+			const void* object;
+			void (*destroy)(const void*);
+		};
+
+		struct Shard {
+			std::mutex write; ///< Serializes writers of the shard.
+			std::atomic<Table*> packages; ///< Readers see tables as immutable apart from filling free slots.
+			std::vector<Retired> retired; ///< Guarded by write.
+		};
+
+		Shard& shard(const std::size_t) const;
+		Package* find(const std::string&, const std::size_t) const;
+		std::size_t insert_batch(const std::string&, Versions);
+		void add_package(Shard&, Package*);
+		void place(Table&, Package*) const;
+		template<typename T> void retire(Shard&, const T*);
+		void reclaim(Shard&);
+
+		std::unique_ptr<Shard[]> shards_;
+		std::size_t shard_count_;
+		Epoch_domain epochs_;
+	};
+}
@@ -0,0 +1,56 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include "semver200.h"
+
+namespace version {
+
+	/// Options for sort_versions().
+	struct Sort_options {
+		/// Number of worker threads; 0 uses all hardware threads.
+		unsigned threads = 1;
+		/// Keep original order of versions of equal precedence, e.g. ones differing only in build metadata.
+		bool stable = false;
+	};
+
+	/// Sort versions in ascending semver 2.0.0 precedence order.
+	/**
+	Instead of calling Semver200_comparator for every pair, a compact key holding major, minor, patch, a
+	release flag and the element's original position is extracted once per version. Keys are ordered with an
+	MSD radix sort, and only runs of keys with equal major.minor.patch that are prereleases are then ordered
+	by comparing their prerelease identifiers. Finally the elements are moved into key order.
+
+	Equal release versions always keep their original order; equal prerelease versions do so only if
+	Sort_options::stable is set. After the first radix pass, buckets are distributed among the worker threads.
+	Versions must have non-negative normal components, as produced by the parser; this precondition is not
+	checked. At most 2^32 - 1 versions can be sorted, and std::length_error is thrown if there are more.
+	*/
+	void sort_versions(std::vector<Semver200_version>&, const Sort_options& = Sort_options());
+
+	/// Sort parsed version data in ascending semver 2.0.0 precedence order.
+	void sort_versions(std::vector<Version_data>&, const Sort_options& = Sort_options());
+}
@@ -0,0 +1,113 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+#include "semver200.h"
+
+namespace version {
+
+	/// Description of a record of a version stream that is not a valid version.
+	struct Record_error {
+		std::size_t line; ///< 1-based number of the record, counting empty records.
+		std::size_t offset; ///< Byte offset of the record's first character in the stream.
+		String_ref text; ///< Record text, truncated to maximum record size if the record is too long.
+		Parse_status status; ///< Parse error within text; code is Parse_errc::ok if record is only too long.
+		bool too_long; ///< Record exceeds maximum record size and was not parsed.
+	};
+
+	/// Receiver of records parsed by Semver200_stream_parser.
+	/**
+	Views and error texts reference the parser's input or internal buffer and are valid only for the duration
+	of the call; they must be copied, e.g. with Version_view::to_data(), to be kept.
+	*/
+	class Record_visitor {
+	public:
+		virtual ~Record_visitor() = default;
+
+		/// Handle valid version found in record with given 1-based number.
+		virtual void version(const Version_view&, const std::size_t line) = 0;
+
+		/// Handle invalid record.
+		virtual void error(const Record_error&) = 0;
+	};
+
+	/// Incremental parser of delimited version records arriving in chunks of arbitrary size.
+	/**
+	Records are separated by a delimiter character, by default newline; a trailing carriage return is ignored
+	when newline is the delimiter, and empty records are skipped. Each record is parsed with Semver200_parser
+	rules directly in the supplied chunk without copying; only a record split between two chunks is assembled
+	in an internal buffer bounded by the maximum record size. Longer records are reported as errors without
+	being parsed, so memory use does not depend on the size of the stream or the length of its records.
+	*/
+	class Semver200_stream_parser {
+	public:
+		static const std::size_t default_max_record_size = 4096;
+
+		explicit Semver200_stream_parser(Record_visitor&, const char delimiter = '\n',
+			const std::size_t max_record_size = default_max_record_size);
+
+		/// Parse all complete records in chunk, keeping an unterminated trailing record for the next chunk.
+		void feed(const char*, const std::size_t);
+
+		/// Parse final record if the stream does not end with a delimiter.
+		void finish();
+
+		/// Parse last chunk of stream; same as feed() followed by finish(), but if no record is pending from
+		/// previous chunks, a final record without delimiter is parsed in place too, so all views and error texts
+		/// reference the chunk.
+		void feed_final(const char*, const std::size_t);
+
+		/// Number of records seen so far, including empty ones.
+		std::size_t lines() const { return line_; }
+
+	private:
+		void consume(const char*, const std::size_t, const bool last);
+		void append(const char*, const std::size_t);
+		void record(const char*, std::size_t);
+
+		Record_visitor& visitor_;
+		char delimiter_;
+		std::size_t max_record_size_;
+		std::vector<char> carry_; ///< Start of record split between chunks.
+		bool overflow_; ///< Split record did not fit into carry_.
+		std::size_t line_;
+		std::size_t position_; ///< Stream offset of next byte to be fed.
+		std::size_t record_offset_; ///< Stream offset of current record.
+	};
+
+	/// Parse delimited version records of a file.
+	/**
+	On POSIX systems the file is memory-mapped in fixed-size windows that are unmapped as soon as they have been
+	parsed, elsewhere it is read in chunks. Throws std::system_error if the file cannot be opened or read.
+	*/
+	void parse_version_file(const std::string& path, Record_visitor&, const char delimiter = '\n');
+
+	/// Parse delimited version records read from a stream in fixed-size chunks.
+	void parse_version_stream(std::istream&, Record_visitor&, const char delimiter = '\n');
+}
@@ -24,8 +24,11 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <ostream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace version {
@@ -70,8 +73,8 @@ namespace version {
 	/// Description of version broken into parts, as per semantic versioning specification.
 	struct Version_data {
 
-		Version_data(const int M, const int m, const int p, const Prerelease_identifiers& pr, const Build_identifiers& b)
-			: major{ M }, minor{ m }, patch{ p }, prerelease_ids{ pr }, build_ids{ b } {}
+		Version_data(const int M, const int m, const int p, Prerelease_identifiers pr, Build_identifiers b)
+			: major{ M }, minor{ m }, patch{ p }, prerelease_ids{ std::move(pr) }, build_ids{ std::move(b) } {}
 
 		int major; ///< Major version, change only on incompatible API modifications.
 		int minor; ///< Minor version, change on backwards-compatible API modifications.
@@ -84,6 +87,17 @@ namespace version {
 		Build_identifiers build_ids;
 	};
 
+	/// Number of characters in canonical textual form of version (X.Y.Z-PR+B).
+	inline std::size_t formatted_size(const Version_data&);
+
+	/// Write canonical textual form of version (X.Y.Z-PR+B) into buffer of given size.
+	/**
+	Returns the number of characters the formatted version takes. If that is more than the buffer size,
+	nothing is written and the caller can retry with a large enough buffer. Output is not NUL-terminated.
+	Formatting does not allocate.
+	*/
+	inline std::size_t to_chars(char*, const std::size_t, const Version_data&);
+
 	// Forward declaration required for operators' template declarations.
 	template<typename Parser, typename Comparator, typename Modifier>
 	class Basic_version;
@@ -129,6 +143,10 @@ namespace version {
 	Basic_version class describes general version object without prescribing parsing,
 	validation, comparison and modification rules. These rules are implemented by supplied Parser, Comparator
 	and Modifier objects.
+
+	Every modification method has two overloads: one called on an lvalue returns a modified copy, and one
+	called on an rvalue (a temporary or std::move'd version) hands its identifiers to the result, so chains
+	like v.set_major(2).set_prerelease("rc.1") copy the identifiers at most once.
 	*/
 	template<typename Parser, typename Comparator, typename Modifier>
 	class Basic_version {
@@ -139,69 +157,101 @@ namespace version {
 		/// Construct Basic_version object using Parser to parse supplied version string, Comparator for comparison and Modifier for modification.
 		Basic_version(const std::string&, Parser, Comparator, Modifier);
 
+		/// Construct Basic_version object using Parser to parse version string given as a range of characters.
+		Basic_version(const char*, const std::size_t, Parser, Comparator, Modifier);
+
 		/// Construct Basic_version object using supplied Version_data, Parser, Comparator and Modifier objects.
 		Basic_version(const Version_data&, Parser, Comparator, Modifier);
 
+		/// Construct Basic_version object taking over storage of supplied Version_data.
+		Basic_version(Version_data&&, Parser, Comparator, Modifier);
+
 		/// Construct Basic_version by copying data from another one.
 		Basic_version(const Basic_version&);
 
 		/// Copy version data from another Basic_version to this one.
 		Basic_version& operator=(const Basic_version&);
 
+		/// Construct Basic_version by taking over identifiers of another one, leaving it valid but unspecified.
+		Basic_version(Basic_version&&) = default;
+
+		/// Take over identifiers of another Basic_version, leaving it valid but unspecified.
+		Basic_version& operator=(Basic_version&&) = default;
+
 		int major() const; ///< Get major version.
 		int minor() const; ///< Get minor version.
 		int patch() const; ///< Get patch version.
 		const std::string prerelease() const; ///< Get prerelease version string.
 		const std::string build() const; ///< Get build version string.
+		const Version_data& data() const; ///< Get parsed version data.
+
+		/// Number of characters in canonical textual form of version (X.Y.Z-PR+B).
+		std::size_t formatted_size() const;
+
+		/// Write canonical textual form of version into buffer; see version::to_chars(char*, std::size_t, const Version_data&).
+		std::size_t to_chars(char*, const std::size_t) const;
 
 		 /// Return a copy of version with major component set to specified value.
-		Basic_version set_major(const int) const;
+		Basic_version set_major(const int) const&;
+		Basic_version set_major(const int) &&;
 
 		/// Return a copy of version with the minor component set to specified value.
-		Basic_version set_minor(const int) const;
+		Basic_version set_minor(const int) const&;
+		Basic_version set_minor(const int) &&;
 
 		/// Return a copy of version with the patch component set to specified value.
-		Basic_version set_patch(const int) const;
+		Basic_version set_patch(const int) const&;
+		Basic_version set_patch(const int) &&;
 
 		/// Return a copy of version with the pre-release component set to specified value.
-		Basic_version set_prerelease(const std::string&) const;
+		Basic_version set_prerelease(const std::string&) const&;
+		Basic_version set_prerelease(const std::string&) &&;
 
 		/// Return a copy of version with the build component set to specified value.
-		Basic_version set_build(const std::string&) const;
+		Basic_version set_build(const std::string&) const&;
+		Basic_version set_build(const std::string&) &&;
 
 		/// Return a copy of version with the major component reset to specified value.
 		/**
 		Exact implementation of reset is delegated to Modifier object. 
 		*/
-		Basic_version reset_major(const int) const;
+		Basic_version reset_major(const int) const&;
+		Basic_version reset_major(const int) &&;
 
 		/// Return a copy of version with the minor component reset to specified value.
 		/**
 		Exact implementation of reset is delegated to Modifier object.
 		*/
-		Basic_version reset_minor(const int) const;
+		Basic_version reset_minor(const int) const&;
+		Basic_version reset_minor(const int) &&;
 
 		/// Return a copy of version with the patch component reset to specified value.
 		/**
 		Exact implementation of reset is delegated to Modifier object.
 		*/
-		Basic_version reset_patch(const int) const;
+		Basic_version reset_patch(const int) const&;
+		Basic_version reset_patch(const int) &&;
 
 		/// Return a copy of version with the pre-release component reset to specified value.
 		/**
 		Exact implementation of reset is delegated to Modifier object.
 		*/
-		Basic_version reset_prerelease(const std::string&) const;
+		Basic_version reset_prerelease(const std::string&) const&;
+		Basic_version reset_prerelease(const std::string&) &&;
 
 		/// Return a copy of version with the build component reset to specified value.
 		/**
 		Exact implementation of reset is delegated to Modifier object.
 		*/
-		Basic_version reset_build(const std::string&) const;
-
-		Basic_version inc_major(const int = 1) const;
-		Basic_version inc_minor(const int = 1) const;
-		Basic_version inc_patch(const int = 1) const;
+		Basic_version reset_build(const std::string&) const&;
+		Basic_version reset_build(const std::string&) &&;
+
+		Basic_version inc_major(const int = 1) const&;
+		Basic_version inc_major(const int = 1) &&;
+		Basic_version inc_minor(const int = 1) const&;
+		Basic_version inc_minor(const int = 1) &&;
+		Basic_version inc_patch(const int = 1) const&;
+		Basic_version inc_patch(const int = 1) &&;
 
 		friend bool operator< <>(const Basic_version&, const Basic_version&);
 		friend bool operator== <>(const Basic_version&, const Basic_version&);
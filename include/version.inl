@@ -24,39 +24,121 @@ SOFTWARE.
 
 #pragma once
 
-#include <sstream>
+#include <cstring>
 #include "version.h"
 
 namespace version {
 
-	namespace {
-
-		/// Utility function to splice all vector elements to output stream, using designated separator 
-		/// between elements and function object for getting values from vector elements.
-		template<typename T, typename F>
-		std::ostream& splice(std::ostream& os, const std::vector<T>& vec, const std::string& sep, F read) {
-			if (!vec.empty()) {
-				for (auto it = vec.cbegin(); it < vec.cend() - 1; ++it) {
-					os << read(*it) << sep;
-				}
-				os << read(*vec.crbegin());
+	namespace detail {
+
+		/// Number of characters in decimal form of value.
+		inline std::size_t int_size(const int v) {
+			unsigned long long u = v < 0 ? 0ull - static_cast<unsigned long long>(v) : static_cast<unsigned long long>(v);
+			std::size_t n = v < 0 ? 2 : 1;
+			while (u >= 10) {
+				u /= 10;
+				++n;
+			}
+			return n;
+		}
+
+		/// Write decimal form of value and return pointer past the last written character.
+		inline char* write_int(char* out, const int v) {
+			const std::size_t n = int_size(v);
+			unsigned long long u = v < 0 ? 0ull - static_cast<unsigned long long>(v) : static_cast<unsigned long long>(v);
+			if (v < 0) *out = '-';
+			char* p = out + n;
+			do {
+				*--p = static_cast<char>('0' + u % 10);
+				u /= 10;
+			} while (u);
+			return out + n;
+		}
+
+		inline const std::string& id_text(const Prerelease_identifier& id) {
+			return id.first;
+		}
+
+		inline const std::string& id_text(const Build_identifier& id) {
+			return id;
+		}
+
+		/// Number of characters in dot-separated list of identifiers.
+		template<typename Ids>
+		std::size_t ids_size(const Ids& ids) {
+			std::size_t n = ids.empty() ? 0 : ids.size() - 1;
+			for (const auto& id : ids) n += id_text(id).size();
+			return n;
+		}
+
+		/// Write dot-separated list of identifiers and return pointer past the last written character.
+		template<typename Ids>
+		char* write_ids(char* out, const Ids& ids) {
+			for (std::size_t i = 0; i < ids.size(); ++i) {
+				if (i > 0) *out++ = '.';
+				const std::string& t = id_text(ids[i]);
+				std::memcpy(out, t.data(), t.size());
+				out += t.size();
 			}
-			return os;
+			return out;
+		}
+
+		/// Format identifiers into a string sized exactly once.
+		template<typename Ids>
+		std::string ids_string(const Ids& ids) {
+			std::string s(ids_size(ids), '\0');
+			if (!s.empty()) write_ids(&s[0], ids);
+			return s;
+		}
+	}
+
+	inline std::size_t formatted_size(const Version_data& v) {
+		std::size_t n = detail::int_size(v.major) + detail::int_size(v.minor) + detail::int_size(v.patch) + 2;
+		if (!v.prerelease_ids.empty()) n += 1 + detail::ids_size(v.prerelease_ids);
+		if (!v.build_ids.empty()) n += 1 + detail::ids_size(v.build_ids);
+		return n;
+	}
+
+	inline std::size_t to_chars(char* buf, const std::size_t size, const Version_data& v) {
+		const std::size_t n = formatted_size(v);
+		if (n > size) return n;
+		char* out = detail::write_int(buf, v.major);
+		*out++ = '.';
+		out = detail::write_int(out, v.minor);
+		*out++ = '.';
+		out = detail::write_int(out, v.patch);
+		if (!v.prerelease_ids.empty()) {
+			*out++ = '-';
+			out = detail::write_ids(out, v.prerelease_ids);
+		}
+		if (!v.build_ids.empty()) {
+			*out++ = '+';
+			detail::write_ids(out, v.build_ids);
 		}
+		return n;
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
 	Basic_version<Parser, Comparator, Modifier>::Basic_version(Parser p, Comparator c, Modifier m)
-		: parser_(p), comparator_(c), modifier_(m), ver_(parser_.parse("0.0.0")) {}
+		: parser_(p), comparator_(c), modifier_(m), ver_(p.parse("0.0.0")) {}
 
 	template<typename Parser, typename Comparator, typename Modifier>
 	Basic_version<Parser, Comparator, Modifier>::Basic_version(const std::string& v, Parser p, Comparator c, Modifier m)
-		: parser_(p), comparator_(c), modifier_(m), ver_(parser_.parse(v)) {}
+		: parser_(p), comparator_(c), modifier_(m), ver_(p.parse(v)) {}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier>::Basic_version(const char* v, const std::size_t n,
+		Parser p, Comparator c, Modifier m)
+		: parser_(p), comparator_(c), modifier_(m), ver_(p.parse(v, n)) {}
 
 	template<typename Parser, typename Comparator, typename Modifier>
 	Basic_version<Parser, Comparator, Modifier>::Basic_version(const Version_data& v, Parser p, Comparator c, Modifier m)
 		: parser_(p), comparator_(c), modifier_(m), ver_(v) {}
 
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier>::Basic_version(Version_data&& v, Parser p, Comparator c, Modifier m)
+		: parser_(p), comparator_(c), modifier_(m), ver_(std::move(v)) {}
+
 	template<typename Parser, typename Comparator, typename Modifier>
 	Basic_version<Parser, Comparator, Modifier>::Basic_version(const Basic_version<Parser, Comparator, Modifier>&) = default;
 
@@ -81,89 +163,179 @@ namespace version {
 
 	template<typename Parser, typename Comparator, typename Modifier>
 	const std::string Basic_version<Parser, Comparator, Modifier>::prerelease() const {
-		std::stringstream ss;
-		splice(ss, ver_.prerelease_ids, ".", [](const auto& id) { return id.first;});
-		return ss.str();
+		return detail::ids_string(ver_.prerelease_ids);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
 	const std::string Basic_version<Parser, Comparator, Modifier>::build() const {
-		std::stringstream ss;
-		splice(ss, ver_.build_ids, ".", [](const auto& id) { return id;});
-		return ss.str();
+		return detail::ids_string(ver_.build_ids);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	const Version_data& Basic_version<Parser, Comparator, Modifier>::data() const {
+		return ver_;
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	std::size_t Basic_version<Parser, Comparator, Modifier>::formatted_size() const {
+		return version::formatted_size(ver_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_major(const int m) const {
+	std::size_t Basic_version<Parser, Comparator, Modifier>::to_chars(char* buf, const std::size_t size) const {
+		return version::to_chars(buf, size, ver_);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_major(const int m) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_major(ver_, m), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_minor(const int m) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_major(const int m) && {
+		ver_ = modifier_.set_major(std::move(ver_), m);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_minor(const int m) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_minor(ver_, m), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_patch(const int p) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_minor(const int m) && {
+		ver_ = modifier_.set_minor(std::move(ver_), m);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_patch(const int p) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_patch(ver_, p), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_prerelease(const std::string& pr) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_patch(const int p) && {
+		ver_ = modifier_.set_patch(std::move(ver_), p);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_prerelease(const std::string& pr) const& {
+		auto vd = parser_.parse("0.0.0-" + pr);
+		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_prerelease(ver_, std::move(vd.prerelease_ids)), parser_, comparator_, modifier_);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_prerelease(const std::string& pr) && {
 		auto vd = parser_.parse("0.0.0-" + pr);
-		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_prerelease(ver_, vd.prerelease_ids), parser_, comparator_, modifier_);
+		ver_ = modifier_.set_prerelease(std::move(ver_), std::move(vd.prerelease_ids));
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_build(const std::string& b) const& {
+		auto vd = parser_.parse("0.0.0+" + b);
+		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_build(ver_, std::move(vd.build_ids)), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_build(const std::string& b) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::set_build(const std::string& b) && {
 		auto vd = parser_.parse("0.0.0+" + b);
-		return Basic_version<Parser, Comparator, Modifier>(modifier_.set_build(ver_, vd.build_ids), parser_, comparator_, modifier_);
+		ver_ = modifier_.set_build(std::move(ver_), std::move(vd.build_ids));
+		return std::move(*this);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_major(const int m) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_major(const int m) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_major(ver_, m), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_minor(const int m) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_major(const int m) && {
+		ver_ = modifier_.reset_major(std::move(ver_), m);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_minor(const int m) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_minor(ver_, m), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_patch(const int p) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_minor(const int m) && {
+		ver_ = modifier_.reset_minor(std::move(ver_), m);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_patch(const int p) const& {
 		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_patch(ver_, p), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_prerelease(const std::string& pr) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_patch(const int p) && {
+		ver_ = modifier_.reset_patch(std::move(ver_), p);
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_prerelease(const std::string& pr) const& {
 		std::string ver = "0.0.0-" + pr;
 		auto vd = parser_.parse(ver);
-		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_prerelease(ver_, vd.prerelease_ids), parser_, comparator_, modifier_);
+		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_prerelease(ver_, std::move(vd.prerelease_ids)), parser_, comparator_, modifier_);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_build(const std::string& b) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_prerelease(const std::string& pr) && {
+		auto vd = parser_.parse("0.0.0-" + pr);
+		ver_ = modifier_.reset_prerelease(std::move(ver_), std::move(vd.prerelease_ids));
+		return std::move(*this);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_build(const std::string& b) const& {
 		std::string ver = "0.0.0+" + b;
 		auto vd = parser_.parse(ver);
-		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_build(ver_, vd.build_ids), parser_, comparator_, modifier_);
+		return Basic_version<Parser, Comparator, Modifier>(modifier_.reset_build(ver_, std::move(vd.build_ids)), parser_, comparator_, modifier_);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::reset_build(const std::string& b) && {
+		auto vd = parser_.parse("0.0.0+" + b);
+		ver_ = modifier_.reset_build(std::move(ver_), std::move(vd.build_ids));
+		return std::move(*this);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_major(const int i) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_major(const int i) const& {
 		return reset_major(ver_.major + i);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_minor(const int i) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_major(const int i) && {
+		return std::move(*this).reset_major(ver_.major + i);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_minor(const int i) const& {
 		return reset_minor(ver_.minor + i);
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
-	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_patch(const int i) const {
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_minor(const int i) && {
+		return std::move(*this).reset_minor(ver_.minor + i);
+	}
+
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_patch(const int i) const& {
 		return reset_patch(ver_.patch + i);
 	}
 
+	template<typename Parser, typename Comparator, typename Modifier>
+	Basic_version<Parser, Comparator, Modifier> Basic_version<Parser, Comparator, Modifier>::inc_patch(const int i) && {
+		return std::move(*this).reset_patch(ver_.patch + i);
+	}
+
 	template<typename Parser, typename Comparator, typename Modifier>
 	bool operator<(const Basic_version<Parser, Comparator, Modifier>& l,
 		const Basic_version<Parser, Comparator, Modifier>& r) {
@@ -179,16 +351,13 @@ namespace version {
 	template<typename Parser, typename Comparator, typename Modifier>
 	std::ostream& operator<<(std::ostream& os,
 		const Basic_version<Parser, Comparator, Modifier>& v) {
-		os << v.ver_.major << "." << v.ver_.minor << "." << v.ver_.patch;
-		std::string prl = v.prerelease();
-		if (!prl.empty()) {
-			os << "-" << prl;
-		}
-		std::string bld = v.build();
-		if (!bld.empty()) {
-			os << "+" << bld;
-		}
-		return os;
+		// Typical versions fit into a small stack buffer; longer ones are formatted into a string.
+		char buf[128];
+		const std::size_t n = to_chars(buf, sizeof(buf), v.ver_);
+		if (n <= sizeof(buf)) return os.write(buf, static_cast<std::streamsize>(n));
+		std::string s(n, '\0');
+		to_chars(&s[0], n, v.ver_);
+		return os.write(s.data(), static_cast<std::streamsize>(n));
 	}
 
 	template<typename Parser, typename Comparator, typename Modifier>
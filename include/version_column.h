@@ -0,0 +1,139 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "semver200.h"
+
+namespace version {
+
+	/// Column-oriented container of semver 2.0.0 versions.
+	/**
+	Instead of storing a Version_data per element, normal version components are kept in three separate
+	contiguous int arrays, and prerelease and build texts of all versions are concatenated into a single
+	character arena addressed by an offset table. Scans over major/minor/patch touch only the arrays they need
+	and a version costs 20 bytes plus its prerelease and build text, with no per-version allocations.
+
+	Elements are accessed as Version_view objects that point into the arena; like iterators of std::vector,
+	they are invalidated by any operation that adds elements. The arena is limited to 4 GiB of text.
+	*/
+	class Version_column {
+	public:
+		using size_type = std::size_t;
+
+		Version_column();
+
+		size_type size() const { return major_.size(); }
+		bool empty() const { return major_.empty(); }
+
+		/// Reserve space for given number of versions and, optionally, given number of prerelease/build bytes.
+		void reserve(const size_type versions, const size_type text_bytes = 0);
+
+		/// Remove all versions.
+		void clear();
+
+		/// Release unused capacity.
+		void shrink_to_fit();
+
+		int major(const size_type i) const { return major_[i]; }
+		int minor(const size_type i) const { return minor_[i]; }
+		int patch(const size_type i) const { return patch_[i]; }
+
+		/// Contiguous array of major versions of all elements.
+		const std::vector<int>& majors() const { return major_; }
+
+		/// Contiguous array of minor versions of all elements.
+		const std::vector<int>& minors() const { return minor_; }
+
+		/// Contiguous array of patch versions of all elements.
+		const std::vector<int>& patches() const { return patch_; }
+
+		/// Get borrowed view of i-th version.
+		Version_view operator[](const size_type i) const;
+
+		/// Copy i-th version into self-contained Version_data.
+		Version_data data(const size_type i) const;
+
+		/// Parse version string and append it; throws Parse_error if string is not a valid version.
+		void push_back(const String_ref&);
+
+		/// Parse version string and append it if valid; column is not modified on error.
+		Parse_status try_push_back(const String_ref&);
+
+		/// Append already parsed version; column is not modified if an exception is thrown.
+		void push_back(const Version_view&);
+
+		/// Append already parsed version; column is not modified if an exception is thrown.
+		void push_back(const Version_data&);
+
+		/// Append all versions of another column, copying its arrays and text arena in bulk.
+		/**
+		Column is not modified if an exception is thrown.
+		*/
+		void append(const Version_column&);
+
+		/// Parse a sequence of version strings and append them in a single pass.
+		/**
+		Elements of the sequence must be convertible to String_ref (e.g. std::string). If any string is invalid,
+		Parse_error is thrown; on that or any other exception the column is restored to the state it had
+		before the call.
+		*/
+		template<typename InputIt>
+		void parse_all(InputIt first, InputIt last);
+
+	private:
+		using Offset = std::uint32_t;
+
+		bool in_text(const String_ref&) const; ///< Test if text lies in this column's arena.
+		void append_text(const String_ref&);
+		void truncate(const size_type);
+
+		std::vector<int> major_;
+		std::vector<int> minor_;
+		std::vector<int> patch_;
+		// Version i has prerelease text in [offsets_[2i], offsets_[2i+1]) and build text in
+		// [offsets_[2i+1], offsets_[2i+2]) of text_.
+		std::vector<Offset> offsets_;
+		std::string text_;
+		Semver200_parser parser_;
+	};
+
+	template<typename InputIt>
+	void Version_column::parse_all(InputIt first, InputIt last) {
+		const size_type original = size();
+		try {
+			for (; first != last; ++first) {
+				auto status = try_push_back(String_ref(*first));
+				if (!status) throw Parse_error(error_message(status));
+			}
+		} catch (...) {
+			truncate(original);
+			throw;
+		}
+	}
+}
@@ -0,0 +1,137 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "semver200.h"
+#include "semver200_range.h"
+
+namespace version {
+
+	/// Sorted set of semver 2.0.0 versions without duplicates.
+	/**
+	Versions are ordered by Semver200_comparator; versions of equal precedence (i.e. differing only in build
+	metadata) are duplicates, and the one inserted first is kept. Lookups accept either a version object, parsed
+	Version_data or a version string, so querying does not require constructing a version object.
+	*/
+	class Version_set {
+	public:
+		/// Strict weak ordering of versions by semver 2.0.0 precedence, usable with Version_data directly.
+		struct Less {
+			using is_transparent = void;
+
+			bool operator()(const Semver200_version& l, const Semver200_version& r) const {
+				return Semver200_comparator().compare(l.data(), r.data()) < 0;
+			}
+			bool operator()(const Semver200_version& l, const Version_data& r) const {
+				return Semver200_comparator().compare(l.data(), r) < 0;
+			}
+			bool operator()(const Version_data& l, const Semver200_version& r) const {
+				return Semver200_comparator().compare(l, r.data()) < 0;
+			}
+		};
+
+		using value_type = Semver200_version;
+		using size_type = std::size_t;
+		using const_iterator = std::set<Semver200_version, Less>::const_iterator;
+		using iterator = const_iterator;
+
+		Version_set() {}
+
+		/// Build set from unsorted sequence of versions or version strings, sorting it once.
+		template<typename It>
+		Version_set(It first, It last) {
+			insert(first, last);
+		}
+
+		const_iterator begin() const { return set_.begin(); }
+		const_iterator end() const { return set_.end(); }
+		size_type size() const { return set_.size(); }
+		bool empty() const { return set_.empty(); }
+
+		/// Remove all versions.
+		void clear() { set_.clear(); }
+
+		/// Insert version; returns false as second member if version of equal precedence is already present.
+		std::pair<const_iterator, bool> insert(const Semver200_version& v) { return set_.insert(v); }
+
+		/// Parse and insert version; throws Parse_error if string is not a valid version.
+		std::pair<const_iterator, bool> insert(const std::string& v) { return set_.insert(Semver200_version(v)); }
+
+		/// Insert unsorted sequence of versions or version strings.
+		/**
+		Input is parsed and sorted as a whole; an empty set is then filled in linear time, otherwise every
+		element is inserted in O(log n).
+		*/
+		template<typename It>
+		void insert(It first, It last) {
+			std::vector<Semver200_version> batch;
+			for (; first != last; ++first) batch.emplace_back(*first);
+			insert_batch(std::move(batch));
+		}
+
+		/// Remove version of equal precedence; returns number of removed versions.
+		size_type erase(const Version_data& v);
+		size_type erase(const Semver200_version& v) { return erase(v.data()); }
+
+		/// Find version of equal precedence, end() if there is none.
+		const_iterator find(const Version_data& v) const { return set_.find(v); }
+		const_iterator find(const Semver200_version& v) const { return set_.find(v.data()); }
+		const_iterator find(const std::string&) const;
+
+		/// First version not lower than the given one.
+		const_iterator lower_bound(const Version_data& v) const { return set_.lower_bound(v); }
+		const_iterator lower_bound(const Semver200_version& v) const { return set_.lower_bound(v.data()); }
+		const_iterator lower_bound(const std::string&) const;
+
+		/// First version higher than the given one.
+		const_iterator upper_bound(const Version_data& v) const { return set_.upper_bound(v); }
+		const_iterator upper_bound(const Semver200_version& v) const { return set_.upper_bound(v.data()); }
+		const_iterator upper_bound(const std::string&) const;
+
+		/// Lowest version higher than the given one, end() if there is none.
+		const_iterator successor(const Version_data& v) const { return upper_bound(v); }
+		const_iterator successor(const Semver200_version& v) const { return upper_bound(v.data()); }
+
+		/// Highest version lower than the given one, end() if there is none.
+		const_iterator predecessor(const Version_data&) const;
+		const_iterator predecessor(const Semver200_version& v) const { return predecessor(v.data()); }
+
+		/// Highest version satisfying the range, end() if there is none.
+		const_iterator max_satisfying(const Semver200_range&) const;
+
+		/// All versions satisfying the range, in ascending order.
+		std::vector<Semver200_version> satisfying(const Semver200_range&) const;
+
+	private:
+		void insert_batch(std::vector<Semver200_version>);
+
+		std::set<Semver200_version, Less> set_;
+	};
+}
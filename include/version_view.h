@@ -0,0 +1,165 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include "version.h"
+
+namespace version {
+
+	/// Non-owning reference to a contiguous range of characters.
+	struct String_ref {
+		constexpr String_ref() : data{ nullptr }, size{ 0 } {}
+		constexpr String_ref(const char* d, const std::size_t n) : data{ d }, size{ n } {}
+		String_ref(const std::string& s) : data{ s.data() }, size{ s.size() } {}
+		String_ref(const char* s) : data{ s }, size{ std::strlen(s) } {}
+
+		constexpr const char* begin() const { return data; }
+		constexpr const char* end() const { return data + size; }
+		constexpr bool empty() const { return size == 0; }
+		std::string str() const { return std::string(data, size); }
+
+		const char* data; ///< First character of referenced range.
+		std::size_t size; ///< Number of characters in referenced range.
+	};
+
+	inline bool operator==(const String_ref& l, const String_ref& r) {
+		return l.size == r.size && (l.size == 0 || std::memcmp(l.data, r.data, l.size) == 0);
+	}
+
+	inline bool operator!=(const String_ref& l, const String_ref& r) {
+		return !(l == r);
+	}
+
+	/// Determine type of prerelease identifier: identifier consisting of digits only is numeric.
+	constexpr Id_type identifier_type(const String_ref& id) {
+		for (const char c : id) {
+			if (c < '0' || c > '9') return Id_type::alnum;
+		}
+		return Id_type::num;
+	}
+
+	/// Borrowed prerelease identifier: value points into source text, type is determined from value.
+	struct Prerelease_identifier_view {
+		constexpr Prerelease_identifier_view(const String_ref& v, const Id_type t) : value{ v }, type{ t } {}
+		constexpr Prerelease_identifier_view(const String_ref& v) : value{ v }, type{ identifier_type(v) } {}
+
+		String_ref value;
+		Id_type type;
+	};
+
+	/// Forward iterator over dot-separated identifiers of validated prerelease or build text.
+	/**
+	Identifiers are produced on the fly by searching for the next separator, so iteration does not allocate.
+	Value type is String_ref for build identifiers and Prerelease_identifier_view for prerelease identifiers.
+	*/
+	template<typename T>
+	class Identifier_iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = T;
+
+		Identifier_iterator() : pos_{ nullptr }, end_{ nullptr } {}
+		Identifier_iterator(const char* pos, const char* end) : pos_{ pos }, end_{ end } {}
+
+		T operator*() const {
+			return T(String_ref(pos_, static_cast<std::size_t>(separator() - pos_)));
+		}
+
+		Identifier_iterator& operator++() {
+			const char* sep = separator();
+			pos_ = sep == end_ ? end_ : sep + 1;
+			return *this;
+		}
+
+		Identifier_iterator operator++(int) {
+			Identifier_iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		friend bool operator==(const Identifier_iterator& l, const Identifier_iterator& r) {
+			return l.pos_ == r.pos_;
+		}
+
+		friend bool operator!=(const Identifier_iterator& l, const Identifier_iterator& r) {
+			return l.pos_ != r.pos_;
+		}
+
+	private:
+		const char* separator() const {
+			const char* p = pos_;
+			while (p != end_ && *p != '.') ++p;
+			return p;
+		}
+
+		const char* pos_;
+		const char* end_;
+	};
+
+	/// Range of identifiers within prerelease or build text, suitable for range-based for loops.
+	template<typename T>
+	struct Identifier_range {
+		Identifier_iterator<T> begin() const { return Identifier_iterator<T>(text.begin(), text.end()); }
+		Identifier_iterator<T> end() const { return Identifier_iterator<T>(text.end(), text.end()); }
+		bool empty() const { return text.empty(); }
+
+		String_ref text;
+	};
+
+	/// Borrowed description of version broken into parts.
+	/**
+	Unlike Version_data, prerelease and build parts are not split into separately allocated identifiers;
+	they reference the text the view was parsed from, so the source buffer must outlive the view.
+	*/
+	struct Version_view {
+		int major; ///< Major version.
+		int minor; ///< Minor version.
+		int patch; ///< Patch version.
+		String_ref prerelease; ///< Prerelease text without leading '-', empty if there is none.
+		String_ref build; ///< Build text without leading '+', empty if there is none.
+
+		/// Iterate over prerelease identifiers.
+		Identifier_range<Prerelease_identifier_view> prerelease_ids() const { return{ prerelease }; }
+
+		/// Iterate over build identifiers.
+		Identifier_range<String_ref> build_ids() const { return{ build }; }
+
+		/// Copy referenced data into self-contained Version_data.
+		Version_data to_data() const {
+			Prerelease_identifiers pr;
+			for (const auto& id : prerelease_ids()) pr.emplace_back(id.value.str(), id.type);
+			Build_identifiers b;
+			for (const auto& id : build_ids()) b.emplace_back(id.str());
+			return Version_data{ major, minor, patch, std::move(pr), std::move(b) };
+		}
+	};
+}
@@ -0,0 +1,71 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "epoch_domain.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		/// Number of reader counters; threads are assigned to them in turn.
+		const size_t reader_stripes = 64;
+
+	}
+
+	Epoch_domain::Epoch_domain() : readers_{ new Reader_stripe[reader_stripes] }, epoch_{ 0 } {
+		for (size_t i = 0; i < reader_stripes; ++i) {
+			readers_[i].active[0].store(0);
+			readers_[i].active[1].store(0);
+		}
+	}
+
+	size_t Epoch_domain::next_stripe() {
+		static atomic<size_t> next{ 0 };
+		return next.fetch_add(1, memory_order_relaxed) % reader_stripes;
+	}
+
+	uint64_t Epoch_domain::epoch() const {
+		return epoch_.load();
+	}
+
+	uint64_t Epoch_domain::advance() {
+		// Two advances let objects stamped just now go at once when no reader is active.
+		advance_once();
+		advance_once();
+		return epoch_.load();
+	}
+
+	void Epoch_domain::advance_once() {
+		// Counters of epoch e - 1 are reused by epoch e + 1, so all readers of e - 1 must have left.
+		uint64_t e = epoch_.load();
+		const size_t previous = (e + 1) & 1;
+		for (size_t i = 0; i < reader_stripes; ++i) {
+			if (readers_[i].active[previous].load() != 0) return;
+		}
+		epoch_.compare_exchange_strong(e, e + 1);
+	}
+}
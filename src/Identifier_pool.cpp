@@ -0,0 +1,71 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "identifier_pool.h"
+
+using namespace std;
+
+namespace version {
+
+	Version_data Interned_version::to_data() const {
+		Prerelease_identifiers pr;
+		for (const auto& id : prerelease_ids) pr.emplace_back(id.first.str(), id.second);
+		Build_identifiers b;
+		for (const auto& id : build_ids) b.emplace_back(id.str());
+		return Version_data{ major, minor, patch, move(pr), move(b) };
+	}
+
+	size_t Identifier_pool::Hash::operator()(const String_ref& s) const {
+		// FNV-1a; identifiers are short, so a simple byte-wise hash is fast enough.
+		size_t h = 14695981039346656037ull;
+		for (const char c : s) {
+			h ^= static_cast<unsigned char>(c);
+			h *= 1099511628211ull;
+		}
+		return h;
+	}
+
+	Identifier_pool::Identifier_pool(const bool thread_safe) : thread_safe_{ thread_safe } {}
+
+	Interned_identifier Identifier_pool::intern(const String_ref& s) {
+		if (!thread_safe_) return insert(s);
+		lock_guard<mutex> lock(mutex_);
+		return insert(s);
+	}
+
+	size_t Identifier_pool::size() const {
+		if (!thread_safe_) return storage_.size();
+		lock_guard<mutex> lock(mutex_);
+		return storage_.size();
+	}
+
+	Interned_identifier Identifier_pool::insert(const String_ref& s) {
+		auto it = index_.find(s);
+		if (it != index_.end()) return Interned_identifier{ it->second };
+		storage_.emplace_back(s.data, s.size);
+		const string* text = &storage_.back();
+		index_.emplace(String_ref(*text), text);
+		return Interned_identifier{ text };
+	}
+}
@@ -0,0 +1,115 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include "memory_resource.h"
+#include "resource_version_data.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		class New_delete_resource : public Memory_resource {
+		protected:
+			void* do_allocate(const size_t bytes, const size_t) override {
+				return ::operator new(bytes);
+			}
+
+			void do_deallocate(void* p, const size_t, const size_t) override {
+				::operator delete(p);
+			}
+		};
+
+		/// Number of bytes to skip from p to reach given power-of-two alignment.
+		inline size_t padding(const char* p, const size_t alignment) {
+			return static_cast<size_t>(-reinterpret_cast<uintptr_t>(p) & (alignment - 1));
+		}
+	}
+
+	Memory_resource* new_delete_resource() noexcept {
+		static New_delete_resource r;
+		return &r;
+	}
+
+	Monotonic_buffer_resource::Monotonic_buffer_resource(const size_t initial_size, Memory_resource* upstream)
+		: upstream_{ upstream }, initial_buffer_{ nullptr }, initial_size_{ 0 }, current_{ nullptr }, remaining_{ 0 },
+		first_block_size_{ max<size_t>(initial_size, sizeof(Block)) }, next_size_{ first_block_size_ }, allocated_{ 0 },
+		blocks_{ nullptr } {}
+
+	Monotonic_buffer_resource::Monotonic_buffer_resource(void* buffer, const size_t size, Memory_resource* upstream)
+		: upstream_{ upstream }, initial_buffer_{ static_cast<char*>(buffer) }, initial_size_{ size },
+		current_{ static_cast<char*>(buffer) }, remaining_{ size }, first_block_size_{ max<size_t>(2 * size, 1024) },
+		next_size_{ first_block_size_ }, allocated_{ 0 }, blocks_{ nullptr } {}
+
+	Monotonic_buffer_resource::~Monotonic_buffer_resource() {
+		release();
+	}
+
+	void Monotonic_buffer_resource::release() {
+		while (blocks_) {
+			Block* next = blocks_->next;
+			upstream_->deallocate(blocks_, blocks_->size);
+			blocks_ = next;
+		}
+		current_ = initial_buffer_;
+		remaining_ = initial_size_;
+		next_size_ = first_block_size_;
+		allocated_ = 0;
+	}
+
+	void* Monotonic_buffer_resource::do_allocate(const size_t bytes, const size_t alignment) {
+		size_t pad = current_ ? padding(current_, alignment) : 0;
+		if (!current_ || pad + bytes > remaining_) {
+			// Block header keeps blocks in a list for release(); it is aligned for any fundamental type.
+			const size_t header = (sizeof(Block) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+			const size_t size = max(next_size_, header + bytes + alignment);
+			Block* b = static_cast<Block*>(upstream_->allocate(size));
+			b->next = blocks_;
+			b->size = size;
+			blocks_ = b;
+			current_ = reinterpret_cast<char*>(b) + header;
+			remaining_ = size - header;
+			next_size_ = size * 2;
+			pad = padding(current_, alignment);
+		}
+		char* p = current_ + pad;
+		current_ = p + bytes;
+		remaining_ -= pad + bytes;
+		allocated_ += bytes;
+		return p;
+	}
+
+	Version_data Resource_version_data::to_data() const {
+		Prerelease_identifiers pr;
+		pr.reserve(prerelease_ids.size());
+		for (const auto& id : prerelease_ids) pr.emplace_back(string(id.first.data(), id.first.size()), id.second);
+		Build_identifiers b;
+		b.reserve(build_ids.size());
+		for (const auto& id : build_ids) b.emplace_back(id.data(), id.size());
+		return Version_data{ major, minor, patch, move(pr), move(b) };
+	}
+}
@@ -0,0 +1,144 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "packed_version.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		string join(const Prerelease_identifiers& ids) {
+			string r;
+			for (const auto& id : ids) {
+				if (!r.empty()) r.push_back('.');
+				r += id.first;
+			}
+			return r;
+		}
+
+		string join(const Build_identifiers& ids) {
+			string r;
+			for (const auto& id : ids) {
+				if (!r.empty()) r.push_back('.');
+				r += id;
+			}
+			return r;
+		}
+	}
+
+	const size_t Packed_version::inline_capacity;
+
+	Packed_version::Packed_version() : major_{ 0 }, minor_{ 0 }, patch_{ 0 }, size_{ 0 }, prerelease_size_{ 0 } {}
+
+	Packed_version::Packed_version(const Version_view& v) : size_{ 0 } {
+		assign(v.major, v.minor, v.patch, v.prerelease, v.build);
+	}
+
+	Packed_version::Packed_version(const Version_data& v) : size_{ 0 } {
+		const string pre = join(v.prerelease_ids);
+		const string build = join(v.build_ids);
+		assign(v.major, v.minor, v.patch, String_ref(pre), String_ref(build));
+	}
+
+	Packed_version::Packed_version(const Packed_version& o) : size_{ 0 } {
+		assign(o.major_, o.minor_, o.patch_, o.prerelease(), o.build());
+	}
+
+	Packed_version::Packed_version(Packed_version&& o) noexcept
+		: major_{ o.major_ }, minor_{ o.minor_ }, patch_{ o.patch_ }, size_{ o.size_ },
+		prerelease_size_{ o.prerelease_size_ } {
+		if (o.is_inline()) {
+			memcpy(inline_, o.inline_, size_);
+		} else {
+			heap_ = o.heap_;
+			o.size_ = 0;
+			o.prerelease_size_ = 0;
+		}
+	}
+
+	Packed_version& Packed_version::operator=(const Packed_version& o) {
+		if (this != &o) {
+			Packed_version tmp(o);
+			*this = move(tmp);
+		}
+		return *this;
+	}
+
+	Packed_version& Packed_version::operator=(Packed_version&& o) noexcept {
+		if (this != &o) {
+			release();
+			major_ = o.major_;
+			minor_ = o.minor_;
+			patch_ = o.patch_;
+			size_ = o.size_;
+			prerelease_size_ = o.prerelease_size_;
+			if (o.is_inline()) {
+				memcpy(inline_, o.inline_, size_);
+			} else {
+				heap_ = o.heap_;
+				o.size_ = 0;
+				o.prerelease_size_ = 0;
+			}
+		}
+		return *this;
+	}
+
+	Packed_version::~Packed_version() {
+		release();
+	}
+
+	/// Replace contents; prerelease and build may point into this object's own text.
+	void Packed_version::assign(const int major, const int minor, const int patch, const String_ref& pre,
+		const String_ref& build) {
+		const size_t n = pre.size + build.size;
+		if (n > numeric_limits<uint32_t>::max()) throw length_error("packed version text exceeds 4 GiB");
+		char buf[inline_capacity];
+		char* dst = n <= inline_capacity ? buf : new char[n];
+		if (pre.size) memcpy(dst, pre.data, pre.size);
+		if (build.size) memcpy(dst + pre.size, build.data, build.size);
+		release();
+		major_ = major;
+		minor_ = minor;
+		patch_ = patch;
+		size_ = static_cast<uint32_t>(n);
+		prerelease_size_ = static_cast<uint32_t>(pre.size);
+		if (n <= inline_capacity) {
+			memcpy(inline_, buf, n);
+		} else {
+			heap_ = dst;
+		}
+	}
+
+	void Packed_version::release() {
+		if (!is_inline()) delete[] heap_;
+		size_ = 0;
+		prerelease_size_ = 0;
+	}
+}
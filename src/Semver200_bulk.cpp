@@ -0,0 +1,164 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include "semver200_bulk.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		/// Range of task indices owned by one worker; owner takes from the front, thieves from the back.
+		struct Task_range {
+			mutex m;
+			size_t begin = 0;
+			size_t end = 0;
+		};
+
+		/// Run f(i) for every task index in [0, n) on given number of threads, balancing load by work stealing.
+		template<typename F>
+		void work_stealing_for(const unsigned threads, const size_t n, F f) {
+			vector<Task_range> ranges(threads);
+			for (unsigned t = 0; t < threads; ++t) {
+				ranges[t].begin = n * t / threads;
+				ranges[t].end = n * (t + 1) / threads;
+			}
+
+			auto worker = [&](const unsigned self) {
+				Task_range& own = ranges[self];
+				for (;;) {
+					size_t task;
+					{
+						lock_guard<mutex> l(own.m);
+						task = own.begin < own.end ? own.begin++ : n;
+					}
+					if (task < n) {
+						f(task);
+						continue;
+					}
+					// Own range is exhausted: steal back half of the first non-empty range of another worker.
+					bool stolen = false;
+					for (unsigned i = 1; i < threads && !stolen; ++i) {
+						Task_range& victim = ranges[(self + i) % threads];
+						size_t b, e;
+						{
+							lock_guard<mutex> l(victim.m);
+							if (victim.begin == victim.end) continue;
+							e = victim.end;
+							b = victim.end - (victim.end - victim.begin + 1) / 2;
+							victim.end = b;
+						}
+						lock_guard<mutex> l(own.m);
+						own.begin = b;
+						own.end = e;
+						stolen = true;
+					}
+					if (!stolen) return;
+				}
+			};
+
+			vector<thread> pool;
+			for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+			worker(0);
+			for (auto& th : pool) th.join();
+		}
+
+		/// Result of parsing one chunk, with line numbers and offsets relative to the chunk.
+		struct Chunk_result : Record_visitor {
+			void version(const Version_view& v, const size_t line) override {
+				versions.push_back(v);
+				lines.push_back(line);
+			}
+
+			void error(const Record_error& e) override {
+				errors.push_back(e);
+			}
+
+			Version_column versions;
+			vector<size_t> lines;
+			vector<Record_error> errors;
+			size_t records = 0;
+		};
+
+		/// Split buffer into chunks of at least chunk_size bytes ending after a delimiter or at end of buffer.
+		vector<size_t> chunk_bounds(const char* data, const size_t n, const Bulk_options& o) {
+			const size_t step = max<size_t>(o.chunk_size, 1);
+			vector<size_t> bounds(1, 0);
+			while (bounds.back() < n) {
+				const size_t from = bounds.back() + step;
+				if (from >= n) {
+					bounds.push_back(n);
+					break;
+				}
+				const void* d = memchr(data + from, o.delimiter, n - from);
+				bounds.push_back(d ? static_cast<size_t>(static_cast<const char*>(d) - data) + 1 : n);
+			}
+			return bounds;
+		}
+	}
+
+	Bulk_result parse_versions_bulk(const char* data, const size_t n, const Bulk_options& o) {
+		const vector<size_t> bounds = chunk_bounds(data, n, o);
+		const size_t chunks = bounds.size() - 1;
+		unsigned threads = o.threads ? o.threads : thread::hardware_concurrency();
+		threads = static_cast<unsigned>(min<size_t>(max(threads, 1u), max<size_t>(chunks, 1)));
+
+		vector<Chunk_result> parts(chunks);
+		work_stealing_for(threads, chunks, [&](const size_t i) {
+			// Shortest valid record with its delimiter takes 6 bytes; typical ones are about twice as long.
+			const size_t estimate = (bounds[i + 1] - bounds[i]) / 12 + 1;
+			parts[i].versions.reserve(estimate);
+			parts[i].lines.reserve(estimate);
+			Semver200_stream_parser parser(parts[i], o.delimiter, numeric_limits<size_t>::max());
+			parser.feed_final(data + bounds[i], bounds[i + 1] - bounds[i]);
+			parts[i].records = parser.lines();
+		});
+
+		Bulk_result r;
+		r.records = 0;
+		size_t versions = 0;
+		for (const auto& p : parts) versions += p.versions.size();
+		r.versions.reserve(versions);
+		r.lines.reserve(versions);
+		for (size_t i = 0; i < chunks; ++i) {
+			Chunk_result& p = parts[i];
+			r.versions.append(p.versions);
+			for (const size_t line : p.lines) r.lines.push_back(r.records + line);
+			for (Record_error e : p.errors) {
+				e.line += r.records;
+				e.offset += bounds[i];
+				r.errors.push_back(e);
+			}
+			r.records += p.records;
+			p.versions = Version_column();
+		}
+		return r;
+	}
+}
@@ -23,9 +23,8 @@ SOFTWARE.
 */
 
 #include <algorithm>
-#include <functional>
-#include <map>
 #include "semver200.h"
+#include "semver200_precedence.h"
 
 using namespace std;
 
@@ -33,78 +32,120 @@ namespace version {
 
 	namespace {
 
-		// Compare normal version identifiers.
-		int compare_normal(const Version_data& l, const Version_data& r) {
-			if (l.major > r.major) return 1;
-			if (l.major < r.major) return -1;
-			if (l.minor > r.minor) return 1;
-			if (l.minor < r.minor) return -1;
-			if (l.patch > r.patch) return 1;
-			if (l.patch < r.patch) return -1;
+		template<typename Ids>
+		inline int cmp_rel_prerel(const Ids& l, const Ids& r) {
+			if (l.empty() && !r.empty()) return 1;
+			if (r.empty() && !l.empty()) return -1;
 			return 0;
 		}
 
-		// Compare alphanumeric prerelease identifiers.
-		inline int cmp_alnum_prerel_ids(const string& l, const string& r) {
-			auto cmp = l.compare(r);
-			if (cmp == 0) {
-				return cmp;
-			} else {
-				return cmp > 0 ? 1 : -1;
-			}
+		// Compare prerelease identifiers based on their types; numeric identifiers have lower precedence.
+		inline int compare_prerel_identifiers(const Prerelease_identifier_view& l,
+			const Prerelease_identifier_view& r) {
+			return detail::compare_identifiers(l.value, l.type, r.value, r.type);
 		}
 
-		// Compare numeric prerelease identifiers.
-		inline int cmp_num_prerel_ids(const string& l, const string& r) {
-			long long li = stoll(l);
-			long long ri = stoll(r);
-			if (li == ri) return 0;
-			return li > ri ? 1 : -1;
-		}
+		// Compare versions whose prerelease identifiers are stored as a vector of (text, type) pairs.
+		template<typename V>
+		int compare_split(const V& l, const V& r) {
+			// Compare normal version components.
+			int cmp = detail::compare_normal(l, r);
+			if (cmp != 0) return cmp;
 
-		using Prerel_type_pair = pair<Id_type, Id_type>;
-		using Prerel_id_comparator = function<int(const string&, const string&)>;
-		const map<Prerel_type_pair, Prerel_id_comparator> comparators = {
-			{ { Id_type::alnum, Id_type::alnum }, cmp_alnum_prerel_ids },
-			{ { Id_type::alnum, Id_type::num }, [](const string&, const string&) {return 1;} },
-			{ { Id_type::num, Id_type::alnum }, [](const string&, const string&) {return -1;} },
-			{ { Id_type::num, Id_type::num }, cmp_num_prerel_ids }
-		};
-
-		// Compare prerelease identifiers based on their types.
-		inline int compare_prerel_identifiers(const Prerelease_identifier& l, const Prerelease_identifier& r) {
-			auto cmp = comparators.at({ l.second, r.second });
-			return cmp(l.first, r.first);
-		}
+			// Compare if one version is release and the other prerelease - release is always higher.
+			cmp = cmp_rel_prerel(l.prerelease_ids, r.prerelease_ids);
+			if (cmp != 0) return cmp;
 
-		inline int cmp_rel_prerel(const Prerelease_identifiers& l, const Prerelease_identifiers& r) {
-			if (l.empty() && !r.empty()) return 1;
-			if (r.empty() && !l.empty()) return -1;
-			return 0;
+			// Compare prerelease by looking at each identifier: numeric ones are compared as numbers,
+			// alphanum as ASCII strings.
+			auto shorter = min(l.prerelease_ids.size(), r.prerelease_ids.size());
+			for (size_t i = 0; i < shorter; i++) {
+				const auto& li = l.prerelease_ids[i];
+				const auto& ri = r.prerelease_ids[i];
+				cmp = compare_prerel_identifiers(Prerelease_identifier_view(String_ref(li.first.data(), li.first.size()),
+					li.second), Prerelease_identifier_view(String_ref(ri.first.data(), ri.first.size()), ri.second));
+				if (cmp != 0) return cmp;
+			}
+
+			// Prerelease identifiers are the same, to the length of the shorter version string;
+			// if they are the same length, then versions are equal, otherwise, longer one wins.
+			if (l.prerelease_ids.size() == r.prerelease_ids.size()) return 0;
+			return l.prerelease_ids.size() > r.prerelease_ids.size() ? 1 : -1;
 		}
 	}
 
 	int Semver200_comparator::compare(const Version_data& l, const Version_data& r) const {
-		// Compare normal version components.
-		int cmp = compare_normal(l, r);
+		return compare_split(l, r);
+	}
+
+	int Semver200_comparator::compare(const Resource_version_data& l, const Resource_version_data& r) const {
+		return compare_split(l, r);
+	}
+
+	int Semver200_comparator::compare(const Version_view& l, const Version_view& r) const {
+		int cmp = detail::compare_normal(l, r);
+		if (cmp != 0) return cmp;
+
+		cmp = cmp_rel_prerel(l.prerelease, r.prerelease);
+		if (cmp != 0) return cmp;
+
+		// Walk both identifier lists in lockstep; list that runs out first has lower precedence.
+		auto lids = l.prerelease_ids();
+		auto rids = r.prerelease_ids();
+		auto li = lids.begin();
+		auto ri = rids.begin();
+		for (; li != lids.end() && ri != rids.end(); ++li, ++ri) {
+			cmp = compare_prerel_identifiers(*li, *ri);
+			if (cmp != 0) return cmp;
+		}
+		if (li == lids.end() && ri == rids.end()) return 0;
+		return li == lids.end() ? -1 : 1;
+	}
+
+	int Semver200_comparator::compare(const Interned_version& l, const Interned_version& r) const {
+		int cmp = detail::compare_normal(l, r);
 		if (cmp != 0) return cmp;
 
-		// Compare if one version is release and the other prerelease - release is always higher.
 		cmp = cmp_rel_prerel(l.prerelease_ids, r.prerelease_ids);
 		if (cmp != 0) return cmp;
 
-		// Compare prerelease by looking at each identifier: numeric ones are compared as numbers,
-		// alphanum as ASCII strings.
 		auto shorter = min(l.prerelease_ids.size(), r.prerelease_ids.size());
 		for (size_t i = 0; i < shorter; i++) {
-			cmp = compare_prerel_identifiers(l.prerelease_ids[i], r.prerelease_ids[i]);
+			const auto& li = l.prerelease_ids[i];
+			const auto& ri = r.prerelease_ids[i];
+			// Identifiers from the same pool are equal exactly when they share storage.
+			if (li.first == ri.first) continue;
+			cmp = compare_prerel_identifiers(Prerelease_identifier_view(li.first.str(), li.second),
+				Prerelease_identifier_view(ri.first.str(), ri.second));
 			if (cmp != 0) return cmp;
 		}
 
-		// Prerelease identifiers are the same, to the length of the shorter version string;
-		// if they are the same length, then versions are equal, otherwise, longer one wins.
 		if (l.prerelease_ids.size() == r.prerelease_ids.size()) return 0;
 		return l.prerelease_ids.size() > r.prerelease_ids.size() ? 1 : -1;
 	}
 
+	int Semver200_comparator::compare(const Packed_version& l, const Packed_version& r) const {
+		return compare(l.view(), r.view());
+	}
+
+	int Semver200_comparator::compare(const char* l, const size_t ln, const char* r, const size_t rn) const {
+		const Semver200_parser parser;
+		return compare(parser.parse_view(l, ln), parser.parse_view(r, rn));
+	}
+
+	int Semver200_comparator::compare(const string& l, const string& r) const {
+		return compare(l.data(), l.size(), r.data(), r.size());
+	}
+
+	Parse_status Semver200_comparator::try_compare(const char* l, const size_t ln, const char* r, const size_t rn,
+		int& result) const {
+		const Semver200_parser parser;
+		Version_view lv{ 0, 0, 0, String_ref(), String_ref() };
+		Version_view rv{ 0, 0, 0, String_ref(), String_ref() };
+		auto status = parser.try_parse(l, ln, lv);
+		if (!status) return status;
+		status = parser.try_parse(r, rn, rv);
+		if (status) result = compare(lv, rv);
+		return status;
+	}
 }
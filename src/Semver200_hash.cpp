@@ -0,0 +1,93 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstring>
+#include "semver200_hash.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		// Finalizer of splitmix64: cheap, and every input bit affects every output bit.
+		inline uint64_t mix(uint64_t x) {
+			x ^= x >> 30;
+			x *= 0xbf58476d1ce4e5b9ull;
+			x ^= x >> 27;
+			x *= 0x94d049bb133111ebull;
+			x ^= x >> 31;
+			return x;
+		}
+
+		// Hash string eight bytes at a time; length is mixed in so that "a" and "a\0" differ.
+		uint64_t hash_bytes(const char* p, const size_t n, uint64_t h) {
+			h = mix(h ^ (n * 0x9e3779b97f4a7c15ull));
+			size_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				uint64_t k;
+				memcpy(&k, p + i, 8);
+				h = mix(h ^ k);
+			}
+			if (i < n) {
+				uint64_t k = 0;
+				memcpy(&k, p + i, n - i);
+				h = mix(h ^ k);
+			}
+			return h;
+		}
+
+		inline uint64_t hash_normal(const Version_data& v) {
+			uint64_t h = mix(static_cast<uint32_t>(v.major));
+			h = mix(h ^ (static_cast<uint64_t>(static_cast<uint32_t>(v.minor)) << 32 | static_cast<uint32_t>(v.patch)));
+			return h;
+		}
+	}
+
+	size_t Semver200_hash::operator()(const Version_data& v) const {
+		uint64_t h = hash_normal(v);
+		for (const auto& id : v.prerelease_ids) {
+			const char* p = id.first.data();
+			size_t n = id.first.size();
+			if (id.second == Id_type::num) {
+				// Numeric identifiers compare by value, so leading zeros must not affect the hash.
+				while (n > 1 && *p == '0') {
+					++p;
+					--n;
+				}
+			}
+			h = hash_bytes(p, n, h ^ static_cast<uint64_t>(id.second));
+		}
+		return static_cast<size_t>(mix(h ^ v.prerelease_ids.size()));
+	}
+
+	size_t Semver200_exact_hash::operator()(const Version_data& v) const {
+		uint64_t h = hash_normal(v);
+		for (const auto& id : v.prerelease_ids) h = hash_bytes(id.first.data(), id.first.size(), h ^ static_cast<uint64_t>(id.second));
+		h = mix(h ^ v.prerelease_ids.size());
+		for (const auto& id : v.build_ids) h = hash_bytes(id.data(), id.size(), h);
+		return static_cast<size_t>(mix(h ^ v.build_ids.size()));
+	}
+}
@@ -0,0 +1,192 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstdint>
+#include "semver200.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		const char prerelease_end = '\x00';
+		const char numeric_tag = '\x01';
+		const char alnum_tag = '\x02';
+		const char release_marker = '\x03';
+		const char terminator = '\x00';
+		const char escaped_zero = '\xff';
+		const unsigned char long_length = 0xff;
+
+		void append_uint(const uint32_t u, string& out) {
+			out.push_back(static_cast<char>(u >> 24));
+			out.push_back(static_cast<char>(u >> 16));
+			out.push_back(static_cast<char>(u >> 8));
+			out.push_back(static_cast<char>(u));
+		}
+
+		// Flip sign bit so that big-endian bytes of negative values sort before positive ones.
+		void append_int(const int v, string& out) {
+			append_uint(static_cast<uint32_t>(v) ^ 0x80000000u, out);
+		}
+
+		// Text is 0-terminated; 0 bytes inside text are escaped as 0 0xff so that terminator sorts first.
+		void append_text(const string& text, string& out) {
+			for (const char c : text) {
+				out.push_back(c);
+				if (c == terminator) out.push_back(escaped_zero);
+			}
+			out.push_back(terminator);
+		}
+
+		// Numeric identifiers are ordered by number of digits first, so digit count precedes digits. Counts
+		// below 255 take one byte; longer counts are 0xff followed by 4-byte big-endian count.
+		void append_number(const string& digits, string& out) {
+			size_t start = 0;
+			while (start + 1 < digits.size() && digits[start] == '0') ++start;
+			const size_t len = digits.size() - start;
+			if (len < long_length) {
+				out.push_back(static_cast<char>(len));
+			} else {
+				out.push_back(static_cast<char>(long_length));
+				append_uint(static_cast<uint32_t>(len), out);
+			}
+			out.append(digits, start, string::npos);
+		}
+
+		/// Sequential reader of encoded key that reports malformed input as Parse_error.
+		class Key_reader {
+		public:
+			Key_reader(const char* s, const size_t n) : pos_{ s }, end_{ s + n } {}
+
+			bool at_end() const {
+				return pos_ == end_;
+			}
+
+			unsigned char byte() {
+				if (pos_ == end_) throw Parse_error("malformed version key: unexpected end");
+				return static_cast<unsigned char>(*pos_++);
+			}
+
+			uint32_t uint() {
+				uint32_t u = 0;
+				for (int i = 0; i < 4; ++i) u = (u << 8) | byte();
+				return u;
+			}
+
+			int integer() {
+				return static_cast<int>(uint() ^ 0x80000000u);
+			}
+
+			string text() {
+				string s;
+				for (;;) {
+					const char c = static_cast<char>(byte());
+					if (c == terminator) {
+						if (pos_ == end_ || *pos_ != escaped_zero) return s;
+						++pos_;
+					}
+					s.push_back(c);
+				}
+			}
+
+			string number() {
+				size_t len = byte();
+				if (len == long_length) len = uint();
+				if (static_cast<size_t>(end_ - pos_) < len) throw Parse_error("malformed version key: unexpected end");
+				string s(pos_, len);
+				pos_ += len;
+				return s;
+			}
+
+		private:
+			const char* pos_;
+			const char* end_;
+		};
+	}
+
+	string Semver200_key_codec::encode(const Version_data& v) const {
+		string key;
+		append(v, key, true);
+		return key;
+	}
+
+	string Semver200_key_codec::encode_precedence(const Version_data& v) const {
+		string key;
+		append(v, key, false);
+		return key;
+	}
+
+	void Semver200_key_codec::append(const Version_data& v, string& out, const bool with_build) const {
+		append_int(v.major, out);
+		append_int(v.minor, out);
+		append_int(v.patch, out);
+		if (v.prerelease_ids.empty()) {
+			out.push_back(release_marker);
+		} else {
+			for (const auto& id : v.prerelease_ids) {
+				if (id.second == Id_type::num) {
+					out.push_back(numeric_tag);
+					append_number(id.first, out);
+				} else {
+					out.push_back(alnum_tag);
+					append_text(id.first, out);
+				}
+			}
+			out.push_back(prerelease_end);
+		}
+		if (with_build) {
+			for (const auto& id : v.build_ids) append_text(id, out);
+		}
+	}
+
+	Version_data Semver200_key_codec::decode(const string& key) const {
+		return decode(key.data(), key.size());
+	}
+
+	Version_data Semver200_key_codec::decode(const char* s, const size_t n) const {
+		Key_reader r(s, n);
+		const int major = r.integer();
+		const int minor = r.integer();
+		const int patch = r.integer();
+		Prerelease_identifiers pr;
+		char c = static_cast<char>(r.byte());
+		if (c != release_marker) {
+			for (;; c = static_cast<char>(r.byte())) {
+				if (c == numeric_tag) {
+					pr.emplace_back(r.number(), Id_type::num);
+				} else if (c == alnum_tag) {
+					pr.emplace_back(r.text(), Id_type::alnum);
+				} else if (c == prerelease_end && !pr.empty()) {
+					break;
+				} else {
+					throw Parse_error("malformed version key: invalid prerelease tag");
+				}
+			}
+		}
+		Build_identifiers b;
+		while (!r.at_end()) b.push_back(r.text());
+		return Version_data{ major, minor, patch, move(pr), move(b) };
+	}
+}
@@ -0,0 +1,182 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <functional>
+#include "semver200_latest.h"
+
+using namespace std;
+
+namespace version {
+
+	Semver200_latest_version::Semver200_latest_version()
+		: own_domain_{ new Epoch_domain }, domain_{ own_domain_.get() }, latest_{ nullptr }, stable_{ nullptr },
+		retired_{ nullptr } {}
+
+	Semver200_latest_version::Semver200_latest_version(Epoch_domain& d)
+		: domain_{ &d }, latest_{ nullptr }, stable_{ nullptr }, retired_{ nullptr } {}
+
+	Semver200_latest_version::~Semver200_latest_version() {
+		if (Snapshot* s = latest_.load()) s->self.reset();
+		if (Snapshot* s = stable_.load()) s->self.reset();
+		for (Snapshot* s = retired_.load(); s;) {
+			Snapshot* next = s->next_retired;
+			s->self.reset();
+			s = next;
+		}
+	}
+
+	bool Semver200_latest_version::publish(const Semver200_version& v) {
+		bool raised;
+		{
+			Epoch_domain::Read_guard guard(*domain_);
+			raised = raise(latest_, v);
+			if (v.data().prerelease_ids.empty()) raised = raise(stable_, v) || raised;
+		}
+		// Outside the guard, which would keep the epoch from moving past snapshots retired just now.
+		if (raised) reclaim();
+		return raised;
+	}
+
+	shared_ptr<const Semver200_version> Semver200_latest_version::latest() const {
+		return load(latest_);
+	}
+
+	shared_ptr<const Semver200_version> Semver200_latest_version::latest_stable() const {
+		return load(stable_);
+	}
+
+	shared_ptr<const Semver200_version> Semver200_latest_version::load(const atomic<Snapshot*>& slot) const {
+		Epoch_domain::Read_guard guard(*domain_);
+		const Snapshot* s = slot.load();
+		return s ? shared_ptr<const Semver200_version>(s->self, &s->version) : nullptr;
+	}
+
+	bool Semver200_latest_version::raise(atomic<Snapshot*>& slot, const Semver200_version& v) {
+		Snapshot* current = slot.load();
+		if (current && !(v > current->version)) return false;
+		// Snapshot and the count shared with readers take a single allocation.
+		const auto s = make_shared<Snapshot>(v);
+		s->self = s;
+		for (;;) {
+			if (current && !(s->version > current->version)) {
+				// A concurrent writer installed a version at least as high; ours was never visible.
+				s->self.reset();
+				return false;
+			}
+			// Sequentially consistent, so the epoch read when retiring current comes after the swap.
+			if (slot.compare_exchange_weak(current, s.get())) {
+				if (current) retire(current);
+				return true;
+			}
+		}
+	}
+
+	void Semver200_latest_version::retire(Snapshot* s) {
+		s->epoch = domain_->epoch();
+		Snapshot* head = retired_.load(memory_order_relaxed);
+		do {
+			s->next_retired = head;
+		} while (!retired_.compare_exchange_weak(head, s, memory_order_release, memory_order_relaxed));
+	}
+
+	void Semver200_latest_version::reclaim() {
+		const uint64_t e = domain_->advance();
+		// Taking the whole stack gives this writer sole ownership of its snapshots.
+		Snapshot* s = retired_.exchange(nullptr, memory_order_acquire);
+		Snapshot* kept = nullptr;
+		Snapshot* kept_last = nullptr;
+		while (s) {
+			Snapshot* next = s->next_retired;
+			if (Epoch_domain::expired(s->epoch, e)) {
+				// Freed now unless readers still hold the version.
+				s->self.reset();
+			} else {
+				s->next_retired = kept;
+				if (!kept) kept_last = s;
+				kept = s;
+			}
+			s = next;
+		}
+		if (!kept) return;
+		Snapshot* head = retired_.load(memory_order_relaxed);
+		do {
+			kept_last->next_retired = head;
+		} while (!retired_.compare_exchange_weak(head, kept, memory_order_release, memory_order_relaxed));
+	}
+
+	Semver200_latest_tracker::Semver200_latest_tracker(const size_t buckets)
+		: buckets_{ new atomic<Entry*>[buckets ? buckets : 1] }, bucket_count_{ buckets ? buckets : 1 } {
+		for (size_t i = 0; i < bucket_count_; ++i) buckets_[i].store(nullptr, memory_order_relaxed);
+	}
+
+	Semver200_latest_tracker::~Semver200_latest_tracker() {
+		for (size_t i = 0; i < bucket_count_; ++i) {
+			for (Entry* e = buckets_[i].load(); e;) {
+				Entry* next = e->next;
+				delete e;
+				e = next;
+			}
+		}
+	}
+
+	bool Semver200_latest_tracker::publish(const string& key, const Semver200_version& v) {
+		if (Entry* e = find(key)) return e->versions.publish(v);
+
+		atomic<Entry*>& head = bucket(key);
+		unique_ptr<Entry> created(new Entry(key, domain_));
+		Entry* first = head.load(memory_order_acquire);
+		Entry* scanned = nullptr;
+		for (;;) {
+			// Only entries pushed since the last attempt need to be checked for a concurrent insert of key.
+			for (Entry* e = first; e != scanned; e = e->next) {
+				if (e->key == key) return e->versions.publish(v);
+			}
+			scanned = first;
+			created->next = first;
+			if (head.compare_exchange_weak(first, created.get(), memory_order_acq_rel, memory_order_acquire)) break;
+		}
+		return created.release()->versions.publish(v);
+	}
+
+	shared_ptr<const Semver200_version> Semver200_latest_tracker::latest(const string& key) const {
+		const Entry* e = find(key);
+		return e ? e->versions.latest() : nullptr;
+	}
+
+	shared_ptr<const Semver200_version> Semver200_latest_tracker::latest_stable(const string& key) const {
+		const Entry* e = find(key);
+		return e ? e->versions.latest_stable() : nullptr;
+	}
+
+	atomic<Semver200_latest_tracker::Entry*>& Semver200_latest_tracker::bucket(const string& key) const {
+		return buckets_[hash<string>()(key) % bucket_count_];
+	}
+
+	Semver200_latest_tracker::Entry* Semver200_latest_tracker::find(const string& key) const {
+		for (Entry* e = bucket(key).load(memory_order_acquire); e; e = e->next) {
+			if (e->key == key) return e;
+		}
+		return nullptr;
+	}
+}
@@ -0,0 +1,64 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "semver200_lazy_version.h"
+
+using namespace std;
+
+namespace version {
+
+	Semver200_lazy_version::Semver200_lazy_version() : Semver200_lazy_version(string("0.0.0")) {}
+
+	Semver200_lazy_version::Semver200_lazy_version(string s) : text_{ move(s) } {
+		init();
+	}
+
+	Semver200_lazy_version::Semver200_lazy_version(const char* s, const size_t n) : text_(s, n) {
+		init();
+	}
+
+	void Semver200_lazy_version::init() {
+		if (text_.size() > numeric_limits<uint32_t>::max()) throw length_error("version text exceeds 4 GiB");
+		// Validating into a view decodes the numeric triple and locates prerelease and build text without
+		// splitting identifiers.
+		const Version_view v = Semver200_parser().parse_view(text_.data(), text_.size());
+		major_ = v.major;
+		minor_ = v.minor;
+		patch_ = v.patch;
+		prerelease_ = v.prerelease.empty() ? 0 : static_cast<uint32_t>(v.prerelease.data - text_.data());
+		prerelease_size_ = static_cast<uint32_t>(v.prerelease.size);
+		build_ = v.build.empty() ? static_cast<uint32_t>(text_.size()) : static_cast<uint32_t>(v.build.data - text_.data());
+	}
+
+	int compare(const Semver200_lazy_version& l, const Semver200_lazy_version& r) {
+		if (l.major() != r.major()) return l.major() > r.major() ? 1 : -1;
+		if (l.minor() != r.minor()) return l.minor() > r.minor() ? 1 : -1;
+		if (l.patch() != r.patch()) return l.patch() > r.patch() ? 1 : -1;
+		if (l.prerelease_text().empty() && r.prerelease_text().empty()) return 0;
+		return Semver200_comparator().compare(l.view(), r.view());
+	}
+}
@@ -23,34 +23,94 @@ SOFTWARE.
 */
 
 #include <climits>
+#include <utility>
 #include "semver200.h"
 
+using namespace std;
+
 namespace version {
 
+	namespace {
+
+		inline bool is_identifier_char(const char c) {
+			return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-';
+		}
+
+		/// Throw Modification_error unless text is empty or a dot-separated sequence of valid identifiers.
+		void check_identifiers(const String_ref& text, const bool prerelease) {
+			if (text.empty()) return;
+			const char* what = prerelease ? "invalid prerelease identifier" : "invalid build identifier";
+			for (const auto& id : Identifier_range<String_ref>{ text }) {
+				if (id.empty()) throw Modification_error(what);
+				for (const char c : id) {
+					if (!is_identifier_char(c)) throw Modification_error(what);
+				}
+				if (prerelease && id.size > 1 && id.data[0] == '0' && identifier_type(id) == Id_type::num) {
+					throw Modification_error("numeric prerelease identifier cannot have leading 0");
+				}
+			}
+			// Identifier_range does not produce the empty identifier after a trailing dot.
+			if (text.data[text.size - 1] == '.') throw Modification_error(what);
+		}
+
+		inline Packed_version packed(const int major, const int minor, const int patch, const String_ref& pre,
+			const String_ref& build) {
+			return Packed_version(Version_view{ major, minor, patch, pre, build });
+		}
+	}
+
 	Version_data Semver200_modifier::set_major(const Version_data& s, const int m) const {
 		if (m < 0) throw Modification_error("major version cannot be less than 0");
 		return Version_data{ m, s.minor, s.patch, s.prerelease_ids, s.build_ids };
 	}
 
+	Version_data Semver200_modifier::set_major(Version_data&& s, const int m) const {
+		if (m < 0) throw Modification_error("major version cannot be less than 0");
+		s.major = m;
+		return move(s);
+	}
+
 	Version_data Semver200_modifier::set_minor(const Version_data& s, const int m) const {
 		if (m < 0) throw Modification_error("minor version cannot be less than 0");
 		return Version_data{ s.major, m, s.patch, s.prerelease_ids, s.build_ids };
 	}
 
+	Version_data Semver200_modifier::set_minor(Version_data&& s, const int m) const {
+		if (m < 0) throw Modification_error("minor version cannot be less than 0");
+		s.minor = m;
+		return move(s);
+	}
+
 	Version_data Semver200_modifier::set_patch(const Version_data& s, const int p) const {
 		if (p < 0) throw Modification_error("patch version cannot be less than 0");
 		return Version_data{ s.major, s.minor, p, s.prerelease_ids, s.build_ids };
 	}
 
-	Version_data Semver200_modifier::set_prerelease(const Version_data& s, const Prerelease_identifiers& pr) const {
-		return Version_data{ s.major, s.minor, s.patch, pr, s.build_ids };
+	Version_data Semver200_modifier::set_patch(Version_data&& s, const int p) const {
+		if (p < 0) throw Modification_error("patch version cannot be less than 0");
+		s.patch = p;
+		return move(s);
+	}
+
+	Version_data Semver200_modifier::set_prerelease(const Version_data& s, Prerelease_identifiers pr) const {
+		return Version_data{ s.major, s.minor, s.patch, move(pr), s.build_ids };
+	}
+
+	Version_data Semver200_modifier::set_prerelease(Version_data&& s, Prerelease_identifiers pr) const {
+		s.prerelease_ids = move(pr);
+		return move(s);
 	}
 
-	Version_data Semver200_modifier::set_build(const Version_data& s, const Build_identifiers& b) const {
-		return Version_data{ s.major, s.minor, s.patch, s.prerelease_ids, b };
+	Version_data Semver200_modifier::set_build(const Version_data& s, Build_identifiers b) const {
+		return Version_data{ s.major, s.minor, s.patch, s.prerelease_ids, move(b) };
 	}
 
-	Version_data Semver200_modifier::reset_major(const Version_data& s, const int m) const {
+	Version_data Semver200_modifier::set_build(Version_data&& s, Build_identifiers b) const {
+		s.build_ids = move(b);
+		return move(s);
+	}
+
+	Version_data Semver200_modifier::reset_major(const Version_data&, const int m) const {
 		if (m < 0) throw Modification_error("major version cannot be less than 0");
 		return Version_data{ m, 0, 0, Prerelease_identifiers{}, Build_identifiers{} };
 	}
@@ -65,11 +125,66 @@ namespace version {
 		return Version_data{ s.major, s.minor, p, Prerelease_identifiers{}, Build_identifiers{} };
 	}
 
-	Version_data Semver200_modifier::reset_prerelease(const Version_data& s, const Prerelease_identifiers& pr) const {
-		return Version_data{ s.major, s.minor, s.patch, pr, Build_identifiers{} };
+	Version_data Semver200_modifier::reset_prerelease(const Version_data& s, Prerelease_identifiers pr) const {
+		return Version_data{ s.major, s.minor, s.patch, move(pr), Build_identifiers{} };
+	}
+
+	Version_data Semver200_modifier::reset_build(const Version_data& s, Build_identifiers b) const {
+		return Version_data{ s.major, s.minor, s.patch, s.prerelease_ids, move(b) };
+	}
+
+	Version_data Semver200_modifier::reset_build(Version_data&& s, Build_identifiers b) const {
+		s.build_ids = move(b);
+		return move(s);
+	}
+
+	Packed_version Semver200_modifier::set_major(const Packed_version& s, const int m) const {
+		if (m < 0) throw Modification_error("major version cannot be less than 0");
+		return packed(m, s.minor(), s.patch(), s.prerelease(), s.build());
+	}
+
+	Packed_version Semver200_modifier::set_minor(const Packed_version& s, const int m) const {
+		if (m < 0) throw Modification_error("minor version cannot be less than 0");
+		return packed(s.major(), m, s.patch(), s.prerelease(), s.build());
+	}
+
+	Packed_version Semver200_modifier::set_patch(const Packed_version& s, const int p) const {
+		if (p < 0) throw Modification_error("patch version cannot be less than 0");
+		return packed(s.major(), s.minor(), p, s.prerelease(), s.build());
+	}
+
+	Packed_version Semver200_modifier::set_prerelease(const Packed_version& s, const String_ref& pr) const {
+		check_identifiers(pr, true);
+		return packed(s.major(), s.minor(), s.patch(), pr, s.build());
+	}
+
+	Packed_version Semver200_modifier::set_build(const Packed_version& s, const String_ref& b) const {
+		check_identifiers(b, false);
+		return packed(s.major(), s.minor(), s.patch(), s.prerelease(), b);
+	}
+
+	Packed_version Semver200_modifier::reset_major(const Packed_version&, const int m) const {
+		if (m < 0) throw Modification_error("major version cannot be less than 0");
+		return packed(m, 0, 0, String_ref(), String_ref());
+	}
+
+	Packed_version Semver200_modifier::reset_minor(const Packed_version& s, const int m) const {
+		if (m < 0) throw Modification_error("minor version cannot be less than 0");
+		return packed(s.major(), m, 0, String_ref(), String_ref());
+	}
+
+	Packed_version Semver200_modifier::reset_patch(const Packed_version& s, const int p) const {
+		if (p < 0) throw Modification_error("patch version cannot be less than 0");
+		return packed(s.major(), s.minor(), p, String_ref(), String_ref());
+	}
+
+	Packed_version Semver200_modifier::reset_prerelease(const Packed_version& s, const String_ref& pr) const {
+		check_identifiers(pr, true);
+		return packed(s.major(), s.minor(), s.patch(), pr, String_ref());
 	}
 
-	Version_data Semver200_modifier::reset_build(const Version_data& s, const Build_identifiers& b) const {
-		return Version_data{ s.major, s.minor, s.patch, s.prerelease_ids, b };
+	Packed_version Semver200_modifier::reset_build(const Packed_version& s, const String_ref& b) const {
+		check_identifiers(b, false);
+		return packed(s.major(), s.minor(), s.patch(), s.prerelease(), b);
 	}
-}
\ No newline at end of file
+}
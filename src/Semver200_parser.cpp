@@ -22,187 +22,208 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
-#include <functional>
-#include <map>
+#include <string>
 #include "semver200.h"
-
-#ifdef _MSC_VER
-// disable symbol name too long warning
-#pragma warning(disable:4503)
-#endif
+#include "semver200_dfa.h"
 
 using namespace std;
 
 namespace version {
 
 	namespace {
-		enum class Parser_state {
-			major, minor, patch, prerelease, build
-		};
 
-		using Validator = function<void(const string&, const char)>;
-		using State_transition_hook = function<void(string&)>;
-		/// State transition is described by a character that triggers it, a state to transition to and
-		/// optional hook to be invoked on transition.
-		using Transition = tuple<const char, Parser_state, State_transition_hook>;
-		using Transitions = vector<Transition>;
-		using State = tuple<Transitions, string&, Validator>;
-		using State_machine = map<Parser_state, State>;
-
-		// Ranges of characters allowed in prerelease and build identifiers.
-		const vector<pair<char, char>> allowed_prerel_id_chars = {
-				{ '0', '9' },{ 'A','Z' },{ 'a','z' },{ '-','-' }
+		/// Collects tokens recognized by the automaton into Version_data components.
+		struct Version_data_sink {
+			int normal_ids[3];
+			Prerelease_identifiers prerelease_ids;
+			Build_identifiers build_ids;
+
+			void normal(const int component, const int value) {
+				normal_ids[component] = value;
+			}
+
+			void prerelease(const char* b, const char* e, const Id_type t) {
+				prerelease_ids.emplace_back(string(b, e), t);
+			}
+
+			void build(const char* b, const char* e) {
+				build_ids.emplace_back(b, e);
+			}
 		};
 
-		inline Transition mkx(const char c, Parser_state p, State_transition_hook pth) {
-			return make_tuple(c, p, pth);
-		}
+		/// Records boundaries of prerelease and build text, leaving identifiers in the source buffer.
+		struct Version_view_sink {
+			int normal_ids[3];
+			const char* prerelease_begin = nullptr;
+			const char* prerelease_end = nullptr;
+			const char* build_begin = nullptr;
+			const char* build_end = nullptr;
 
-		/// Advance parser state machine by a single step.
-		/**
-		Perform single step of parser state machine: if character matches one from transition tables -
-		trigger transition to next state; otherwise, validate if current token is in legal state
-		(throw Parse_error if not) and then add character to current token; State transition includes
-		preparing various vars for next state and invoking state transition hook (if specified) which is
-		where whole tokens are validated.
-		*/
-		inline void process_char(const char c, Parser_state& cstate, Parser_state& pstate,
-			const Transitions& transitions, string& target, Validator validate) {
-			for (const auto& transition : transitions) {
-				if (c == get<0>(transition)) {
-					if (get<2>(transition)) get<2>(transition)(target);
-					pstate = cstate;
-					cstate = get<1>(transition);
-					return;
-				}
+			void normal(const int component, const int value) {
+				normal_ids[component] = value;
 			}
-			validate(target, c);
-			target.push_back(c);
-		}
 
-		/// Validate normal (major, minor, patch) version components.
-		inline void normal_version_validator(const string& tgt, const char c) {
-			if (c < '0' || c > '9') throw Parse_error("invalid character encountered: " + string(1, c));
-			if (tgt.compare(0, 1, "0") == 0) throw Parse_error("leading 0 not allowed");
-		}
+			void prerelease(const char* b, const char* e, const Id_type) {
+				if (!prerelease_begin) prerelease_begin = b;
+				prerelease_end = e;
+			}
 
-		/// Validate that prerelease and build version identifiers are comprised of allowed chars only.
-		inline void prerelease_version_validator(const string&, const char c) {
-			bool res = false;
-			for (const auto& r : allowed_prerel_id_chars) {
-				res |= (c >= r.first && c <= r.second);
+			void build(const char* b, const char* e) {
+				if (!build_begin) build_begin = b;
+				build_end = e;
 			}
-			if (!res)
-				throw Parse_error("invalid character encountered: " + string(1, c));
-		}
+		};
 
-		inline bool is_identifier_numeric(const string& id) {
-			return id.find_first_not_of("0123456789") == string::npos;
-		}
+		/// Collects identifiers into vectors allocated from a memory resource.
+		struct Resource_version_data_sink {
+			explicit Resource_version_data_sink(Memory_resource* r) : resource(r), prerelease_ids(r), build_ids(r) {}
 
-		inline bool check_for_leading_0(const string& str) {
-			return str.length() > 1 && str[0] == '0';
-		}
+			int normal_ids[3];
+			Memory_resource* resource;
+			Resource_prerelease_identifiers prerelease_ids;
+			Resource_build_identifiers build_ids;
+
+			void normal(const int component, const int value) {
+				normal_ids[component] = value;
+			}
+
+			void prerelease(const char* b, const char* e, const Id_type t) {
+				prerelease_ids.emplace_back(Resource_string(b, e, resource), t);
+			}
 
-		/// Validate every individual prerelease identifier, determine it's type and add it to collection.
-		void prerelease_hook_impl(string& id, Prerelease_identifiers& prerelease) {
-			if (id.empty()) throw Parse_error("version identifier cannot be empty");
-			Id_type t = Id_type::alnum;
-			if (is_identifier_numeric(id)) {
-				t = Id_type::num;
-				if (check_for_leading_0(id)) {
-					throw Parse_error("numeric identifiers cannot have leading 0");
-				}
+			void build(const char* b, const char* e) {
+				build_ids.emplace_back(b, e, resource);
 			}
-			prerelease.push_back(Prerelease_identifier(id, t));
-			id.clear();
+		};
+
+		inline Parse_status make_status(const dfa::Scan_status& status, const char* s, const size_t n) {
+			return Parse_status{ status.code, status.offset, status.offset < n ? s[status.offset] : '\0' };
 		}
+	}
 
-		/// Validate every individual build identifier and add it to collection.
-		void build_hook_impl(string& id, Parser_state& pstate, Build_identifiers& build,
-			std::string& prerelease_id, Prerelease_identifiers& prerelease) {
-			// process last token left from parsing prerelease data
-			if (pstate == Parser_state::prerelease) prerelease_hook_impl(prerelease_id, prerelease);
-			if (id.empty()) throw Parse_error("version identifier cannot be empty");
-			build.push_back(id);
-			id.clear();
+	string error_message(const Parse_status& status) {
+		switch (status.code) {
+		case Parse_errc::ok:
+			return "no error";
+		case Parse_errc::invalid_character:
+			return "invalid character encountered: " + string(1, status.character);
+		case Parse_errc::leading_zero:
+			return "leading 0 not allowed";
+		case Parse_errc::numeric_leading_zero:
+			return "numeric identifiers cannot have leading 0";
+		case Parse_errc::empty_identifier:
+			return "version identifier cannot be empty";
+		case Parse_errc::empty_number:
+			return "normal version component cannot be empty";
+		case Parse_errc::unexpected_end:
+			return "unexpected end of version string";
+		case Parse_errc::out_of_range:
+			return "normal version component out of range";
 		}
+		return "unknown error";
+	}
+
+	Version_data Semver200_parser::parse(const string& s) const {
+		return parse(s.data(), s.size());
+	}
+
+	Version_data Semver200_parser::parse(const char* s, const size_t n) const {
+		Version_data v{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} };
+		auto status = try_parse(s, n, v);
+		if (!status) throw Parse_error(error_message(status));
+		return v;
+	}
 
+	Version_view Semver200_parser::parse_view(const char* s, const size_t n) const {
+		Version_view v{ 0, 0, 0, String_ref(), String_ref() };
+		auto status = try_parse(s, n, v);
+		if (!status) throw Parse_error(error_message(status));
+		return v;
 	}
 
 	/// Parse semver 2.0.0-compatible string to Version_data structure.
 	/**
-	Version text parser is implemented as a state machine. In each step one successive character from version
-	string is consumed and is either added to current token or triggers state transition. Hooks can be
-	injected into state transitions for validation/customization purposes.
+	Version text is recognized by a table-driven automaton (see semver200_dfa.h): each character is
+	classified and, together with current state, looked up in a static transition table which says
+	what state comes next and whether a complete token should be emitted. Only output identifiers are
+	allocated.
 	*/
-	Version_data Semver200_parser::parse(const string& s) const {
-		string major;
-		string minor;
-		string patch;
-		string prerelease_id;
-		string build_id;
-		Prerelease_identifiers prerelease;
-		Build_identifiers build;
-		Parser_state cstate{ Parser_state::major };
-		Parser_state pstate;
-
-		auto prerelease_hook = [&](string& id) {
-			prerelease_hook_impl(id, prerelease);
-		};
+	Parse_status Semver200_parser::try_parse(const char* s, const size_t n, Version_data& out) const {
+		Version_data_sink sink;
+		auto status = dfa::scan(s, n, sink);
+		if (status.code == Parse_errc::ok) {
+			out.major = sink.normal_ids[0];
+			out.minor = sink.normal_ids[1];
+			out.patch = sink.normal_ids[2];
+			out.prerelease_ids = move(sink.prerelease_ids);
+			out.build_ids = move(sink.build_ids);
+		}
+		return make_status(status, s, n);
+	}
 
-		auto build_hook = [&](string& id) {
-			build_hook_impl(id, pstate, build, prerelease_id, prerelease);
-		};
+	Parse_status Semver200_parser::try_parse(const string& s, Version_data& out) const {
+		return try_parse(s.data(), s.size(), out);
+	}
 
-		// State transition tables
-		auto major_trans = {
-			mkx('.', Parser_state::minor, {})
-		};
-		auto minor_trans = {
-			mkx('.', Parser_state::patch, {})
-		};
-		auto patch_trans = {
-			mkx('-', Parser_state::prerelease, {}),
-			mkx('+', Parser_state::build, {})
-		};
-		auto prerelease_trans = {
-			// When identifier separator (.) is found, stay in the same state but invoke hook
-			// in order to process each individual identifier separately.
-			mkx('.', Parser_state::prerelease, prerelease_hook),
-			mkx('+', Parser_state::build, {})
-		};
-		auto build_trans = {
-			// Same stay-in-the-same-state-but-invoke-hook trick from above.
-			mkx('.', Parser_state::build, build_hook)
-		};
+	Parse_status Semver200_parser::try_parse(const char* s, const size_t n, Version_view& out) const {
+		Version_view_sink sink;
+		auto status = dfa::scan(s, n, sink);
+		if (status.code == Parse_errc::ok) {
+			out = Version_view{ sink.normal_ids[0], sink.normal_ids[1], sink.normal_ids[2],
+				String_ref(sink.prerelease_begin, static_cast<size_t>(sink.prerelease_end - sink.prerelease_begin)),
+				String_ref(sink.build_begin, static_cast<size_t>(sink.build_end - sink.build_begin)) };
+		}
+		return make_status(status, s, n);
+	}
 
-		State_machine state_machine = {
-			{Parser_state::major, State{major_trans, major, normal_version_validator}},
-			{Parser_state::minor, State{minor_trans, minor, normal_version_validator}},
-			{Parser_state::patch, State{patch_trans, patch, normal_version_validator}},
-			{Parser_state::prerelease, State{prerelease_trans, prerelease_id, prerelease_version_validator}},
-			{Parser_state::build, State{build_trans, build_id, prerelease_version_validator}}
-		};
+	Resource_version_data Semver200_parser::parse(const char* s, const size_t n, Memory_resource* r) const {
+		Resource_version_data v(r);
+		auto status = try_parse(s, n, v);
+		if (!status) throw Parse_error(error_message(status));
+		return v;
+	}
 
-		// Main loop.
-		for (const auto& c : s) {
-			auto state = state_machine.at(cstate);
-			process_char(c, cstate, pstate, get<0>(state), get<1>(state), get<2>(state));
+	Parse_status Semver200_parser::try_parse(const char* s, const size_t n, Resource_version_data& out) const {
+		Resource_version_data_sink sink(out.resource());
+		auto status = dfa::scan(s, n, sink);
+		if (status.code == Parse_errc::ok) {
+			out.major = sink.normal_ids[0];
+			out.minor = sink.normal_ids[1];
+			out.patch = sink.normal_ids[2];
+			out.prerelease_ids = move(sink.prerelease_ids);
+			out.build_ids = move(sink.build_ids);
 		}
+		return make_status(status, s, n);
+	}
 
-		// Trigger appropriate hooks in order to process last token, because no state transition was
-		// triggered for it.
-		if (cstate == Parser_state::prerelease) {
-			prerelease_hook(prerelease_id);
-		} else if (cstate == Parser_state::build) {
-			build_hook(build_id);
-		}
+	Interned_version Semver200_parser::parse(const char* s, const size_t n, Identifier_pool& pool) const {
+		Interned_version v{ 0, 0, 0, {}, {} };
+		auto status = try_parse(s, n, v, pool);
+		if (!status) throw Parse_error(error_message(status));
+		return v;
+	}
 
-		try {
-			return Version_data{ stoi(major), stoi(minor), stoi(patch), prerelease, build };
-		} catch (invalid_argument& ex) {
-			throw Parse_error(ex.what());
-		}
+	Packed_version Semver200_parser::parse_packed(const char* s, const size_t n) const {
+		return Packed_version(parse_view(s, n));
+	}
+
+	Parse_status Semver200_parser::try_parse(const char* s, const size_t n, Packed_version& out) const {
+		Version_view v{ 0, 0, 0, String_ref(), String_ref() };
+		auto status = try_parse(s, n, v);
+		if (status) out = Packed_version(v);
+		return status;
+	}
+
+	Parse_status Semver200_parser::try_parse(const char* s, const size_t n, Interned_version& out,
+		Identifier_pool& pool) const {
+		// Whole string is validated before anything is interned, so rejected input leaves no entries in the pool.
+		Version_view v{ 0, 0, 0, String_ref(), String_ref() };
+		auto status = try_parse(s, n, v);
+		if (!status) return status;
+		Interned_version result{ v.major, v.minor, v.patch, {}, {} };
+		for (const auto& id : v.prerelease_ids()) result.prerelease_ids.emplace_back(pool.intern(id.value), id.type);
+		for (const auto& id : v.build_ids()) result.build_ids.push_back(pool.intern(id));
+		out = move(result);
+		return status;
 	}
 }
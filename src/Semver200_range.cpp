@@ -0,0 +1,383 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <climits>
+#include "semver200_range.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		const Semver200_comparator comparator;
+		const Semver200_parser parser;
+
+		enum class Op {
+			ge, gt, le, lt, eq
+		};
+
+		/// Single primitive comparator, result of desugaring tilde, caret, x- and hyphen ranges.
+		struct Constraint {
+			Op op;
+			Version_data version;
+			/// Set if comparator was written with a prerelease, which admits prereleases of the same version.
+			bool prerelease;
+		};
+
+		/// Possibly partial version from constraint expression: only first count components are given.
+		struct Partial {
+			int ids[3];
+			int count;
+			Prerelease_identifiers prerelease;
+		};
+
+		inline Version_data release(const int M, const int m, const int p) {
+			return Version_data{ M, m, p, Prerelease_identifiers{}, Build_identifiers{} };
+		}
+
+		/// Lowest version with given major, minor and patch: X.Y.Z-0.
+		inline Version_data floor(const int M, const int m, const int p) {
+			return Version_data{ M, m, p, Prerelease_identifiers{ { "0", Id_type::num } }, Build_identifiers{} };
+		}
+
+		// Lowest version above all versions with given prefix; false if there is none because of int overflow.
+		bool next_major(const int M, Version_data& out) {
+			if (M == INT_MAX) return false;
+			out = floor(M + 1, 0, 0);
+			return true;
+		}
+
+		bool next_minor(const int M, const int m, Version_data& out) {
+			if (m == INT_MAX) return next_major(M, out);
+			out = floor(M, m + 1, 0);
+			return true;
+		}
+
+		bool next_patch(const int M, const int m, const int p, Version_data& out) {
+			if (p == INT_MAX) return next_minor(M, m, out);
+			out = floor(M, m, p + 1);
+			return true;
+		}
+
+		/// Immediate successor of version in precedence order.
+		bool successor(const Version_data& v, Version_data& out) {
+			if (v.prerelease_ids.empty()) return next_patch(v.major, v.minor, v.patch, out);
+			out = Version_data{ v.major, v.minor, v.patch, v.prerelease_ids, Build_identifiers{} };
+			out.prerelease_ids.emplace_back("0", Id_type::num);
+			return true;
+		}
+
+		inline bool same_normal(const Version_data& l, const Version_data& r) {
+			return l.major == r.major && l.minor == r.minor && l.patch == r.patch;
+		}
+
+		inline bool is_space(const char c) {
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+		}
+
+		/// Parse number component of partial version; leading zeros are not allowed, as in versions.
+		bool parse_number(const string& s, int& out) {
+			if (s.empty() || s.size() > 10 || (s.size() > 1 && s[0] == '0')) return false;
+			long long v = 0;
+			for (const char c : s) {
+				if (c < '0' || c > '9') return false;
+				v = v * 10 + (c - '0');
+			}
+			if (v > INT_MAX) return false;
+			out = static_cast<int>(v);
+			return true;
+		}
+
+		inline bool is_wildcard(const string& s) {
+			return s == "x" || s == "X" || s == "*";
+		}
+
+		Partial parse_partial(string s) {
+			if (!s.empty() && (s[0] == 'v' || s[0] == 'V')) s.erase(0, 1);
+			if (s.empty()) throw Parse_error("version expected in range: " + s);
+
+			Partial p{ { 0, 0, 0 }, 0, Prerelease_identifiers{} };
+			Version_data v{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} };
+			if (parser.try_parse(s, v)) {
+				p.ids[0] = v.major;
+				p.ids[1] = v.minor;
+				p.ids[2] = v.patch;
+				p.count = 3;
+				p.prerelease = move(v.prerelease_ids);
+				return p;
+			}
+
+			// Not a full version, so it must be a dot-separated prefix of numbers followed by wildcards.
+			size_t start = 0;
+			int components = 0;
+			bool wildcard = false;
+			for (;;) {
+				size_t dot = s.find('.', start);
+				const string id = s.substr(start, dot == string::npos ? string::npos : dot - start);
+				if (++components > 3) throw Parse_error("too many version components in range: " + s);
+				if (is_wildcard(id)) {
+					wildcard = true;
+				} else if (wildcard || !parse_number(id, p.ids[p.count])) {
+					throw Parse_error("invalid version in range: " + s);
+				} else {
+					++p.count;
+				}
+				if (dot == string::npos) break;
+				start = dot + 1;
+			}
+			return p;
+		}
+
+		/// Split comparator set into words, attaching stand-alone operators to the version that follows them.
+		vector<string> tokenize(const string& s) {
+			vector<string> words;
+			string word;
+			for (const char c : s) {
+				if (is_space(c) || c == ',') {
+					if (!word.empty()) words.push_back(move(word));
+					word.clear();
+				} else {
+					word.push_back(c);
+				}
+			}
+			if (!word.empty()) words.push_back(move(word));
+
+			vector<string> tokens;
+			for (size_t i = 0; i < words.size(); ++i) {
+				if (words[i].find_first_not_of("<>=~^") == string::npos && words[i] != "-" && i + 1 < words.size()) {
+					tokens.push_back(words[i] + words[i + 1]);
+					++i;
+				} else {
+					tokens.push_back(words[i]);
+				}
+			}
+			return tokens;
+		}
+
+		class Set_builder {
+		public:
+			Set_builder() : empty_{ false } {}
+
+			void add(const Op op, Version_data v, const bool prerelease) {
+				constraints_.push_back(Constraint{ op, move(v), prerelease });
+			}
+
+			void add(const Op op, const Partial& p) {
+				add(op, Version_data{ p.ids[0], p.ids[1], p.ids[2], p.prerelease, Build_identifiers{} },
+					!p.prerelease.empty());
+			}
+
+			/// Add exclusive upper bound right above all versions sharing first count components of partial.
+			void add_prefix_upper(const Partial& p, const int count) {
+				Version_data v{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} };
+				bool bounded = count == 1 ? next_major(p.ids[0], v)
+					: count == 2 ? next_minor(p.ids[0], p.ids[1], v)
+					: next_patch(p.ids[0], p.ids[1], p.ids[2], v);
+				if (bounded) add(Op::lt, move(v), false);
+			}
+
+			void match_nothing() {
+				empty_ = true;
+			}
+
+			void primitive(const string& token) {
+				size_t op_len = token.find_first_not_of("<>=~^");
+				if (op_len == string::npos) throw Parse_error("version expected in range: " + token);
+				const string op = token.substr(0, op_len);
+				const Partial p = parse_partial(token.substr(op_len));
+				const Version_data floor_v = release(p.ids[0], p.ids[1], p.ids[2]);
+
+				if (op.empty() || op == "=") {
+					if (p.count == 3) {
+						add(Op::eq, p);
+					} else if (p.count > 0) {
+						add(Op::ge, floor_v, false);
+						add_prefix_upper(p, p.count);
+					}
+				} else if (op == ">") {
+					if (p.count == 3) {
+						add(Op::gt, p);
+					} else if (p.count > 0) {
+						Version_data v = floor_v;
+						if (next_prefix(p, v)) add(Op::ge, release(v.major, v.minor, v.patch), false);
+						else match_nothing();
+					} else {
+						match_nothing();
+					}
+				} else if (op == ">=") {
+					if (p.count == 3) add(Op::ge, p);
+					else if (p.count > 0) add(Op::ge, floor_v, false);
+				} else if (op == "<") {
+					if (p.count == 3) add(Op::lt, p);
+					else if (p.count > 0) add(Op::lt, floor(p.ids[0], p.ids[1], p.ids[2]), false);
+					else match_nothing();
+				} else if (op == "<=") {
+					if (p.count == 3) add(Op::le, p);
+					else if (p.count > 0) add_prefix_upper(p, p.count);
+				} else if (op == "~" || op == "~>") {
+					if (p.count == 3) add(Op::ge, p);
+					else if (p.count > 0) add(Op::ge, floor_v, false);
+					if (p.count > 0) add_prefix_upper(p, p.count == 1 ? 1 : 2);
+				} else if (op == "^") {
+					if (p.count == 3) add(Op::ge, p);
+					else if (p.count > 0) add(Op::ge, floor_v, false);
+					// Allow changes that keep the left-most non-zero component; components that were not given
+					// count as non-zero.
+					if (p.count > 0) {
+						int keep = 1;
+						if (p.ids[0] == 0 && p.count >= 2) keep = (p.ids[1] == 0 && p.count == 3) ? 3 : 2;
+						add_prefix_upper(p, keep);
+					}
+				} else {
+					throw Parse_error("invalid operator in range: " + op);
+				}
+			}
+
+			void hyphen(const string& from, const string& to) {
+				const Partial l = parse_partial(from);
+				const Partial u = parse_partial(to);
+				if (l.count == 3) add(Op::ge, l);
+				else if (l.count > 0) add(Op::ge, release(l.ids[0], l.ids[1], l.ids[2]), false);
+				if (u.count == 3) add(Op::le, u);
+				else if (u.count > 0) add_prefix_upper(u, u.count);
+			}
+
+			/// Intersect all comparators into a single interval; return false if it is empty.
+			bool build(Version_interval& iv) const {
+				if (empty_) return false;
+				for (const auto& c : constraints_) {
+					Version_data s{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} };
+					switch (c.op) {
+					case Op::ge:
+						lower(iv, c.version, c.prerelease);
+						break;
+					case Op::gt:
+						if (!successor(c.version, s)) return false;
+						lower(iv, s, c.prerelease);
+						break;
+					case Op::lt:
+						upper(iv, c.version, c.prerelease);
+						break;
+					case Op::le:
+						if (successor(c.version, s)) upper(iv, s, c.prerelease);
+						break;
+					case Op::eq:
+						lower(iv, c.version, c.prerelease);
+						if (successor(c.version, s)) upper(iv, s, c.prerelease);
+						break;
+					}
+				}
+				// A redundant comparator may still admit prereleases of the same major.minor.patch as the bound
+				// that superseded it.
+				for (const auto& c : constraints_) {
+					if (!c.prerelease) continue;
+					if (iv.has_lower && same_normal(c.version, iv.lower)) iv.lower_prerelease = true;
+					if (iv.has_upper && same_normal(c.version, iv.upper)) iv.upper_prerelease = true;
+				}
+				return !(iv.has_lower && iv.has_upper && comparator.compare(iv.lower, iv.upper) >= 0);
+			}
+
+		private:
+			static bool next_prefix(const Partial& p, Version_data& v) {
+				return p.count == 1 ? next_major(p.ids[0], v) : next_minor(p.ids[0], p.ids[1], v);
+			}
+
+			static void lower(Version_interval& iv, const Version_data& v, const bool prerelease) {
+				int cmp = iv.has_lower ? comparator.compare(v, iv.lower) : 1;
+				if (cmp > 0) {
+					iv.lower = v;
+					iv.has_lower = true;
+					iv.lower_prerelease = prerelease;
+				} else if (cmp == 0) {
+					iv.lower_prerelease |= prerelease;
+				}
+			}
+
+			static void upper(Version_interval& iv, const Version_data& v, const bool prerelease) {
+				int cmp = iv.has_upper ? comparator.compare(v, iv.upper) : -1;
+				if (cmp < 0) {
+					iv.upper = v;
+					iv.has_upper = true;
+					iv.upper_prerelease = prerelease;
+				} else if (cmp == 0) {
+					iv.upper_prerelease |= prerelease;
+				}
+			}
+
+			vector<Constraint> constraints_;
+			bool empty_;
+		};
+	}
+
+	Version_interval::Version_interval()
+		: lower{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} },
+		upper{ 0, 0, 0, Prerelease_identifiers{}, Build_identifiers{} },
+		has_lower{ false }, has_upper{ false }, lower_prerelease{ false }, upper_prerelease{ false } {}
+
+	bool Version_interval::contains(const Version_data& v) const {
+		if (has_lower && comparator.compare(v, lower) < 0) return false;
+		return !has_upper || comparator.compare(v, upper) < 0;
+	}
+
+	bool Version_interval::admits_prerelease(const Version_data& v) const {
+		if (v.prerelease_ids.empty()) return true;
+		return (lower_prerelease && same_normal(v, lower)) || (upper_prerelease && same_normal(v, upper));
+	}
+
+	Semver200_range::Semver200_range(const string& s, const bool include_prerelease)
+		: include_prerelease_{ include_prerelease } {
+		size_t start = 0;
+		for (;;) {
+			size_t bar = s.find("||", start);
+			const vector<string> tokens = tokenize(s.substr(start, bar == string::npos ? string::npos : bar - start));
+
+			Set_builder set;
+			for (size_t i = 0; i < tokens.size(); ++i) {
+				if (i + 2 < tokens.size() && tokens[i + 1] == "-") {
+					set.hyphen(tokens[i], tokens[i + 2]);
+					i += 2;
+				} else {
+					set.primitive(tokens[i]);
+				}
+			}
+			Version_interval iv;
+			if (set.build(iv)) intervals_.push_back(move(iv));
+
+			if (bar == string::npos) break;
+			start = bar + 2;
+		}
+	}
+
+	bool Semver200_range::satisfies(const Version_data& v) const {
+		for (const auto& iv : intervals_) {
+			if (iv.contains(v) && (include_prerelease_ || iv.admits_prerelease(v))) return true;
+		}
+		return false;
+	}
+
+	bool Semver200_range::satisfies(const Semver200_version& v) const {
+		return satisfies(v.data());
+	}
+}
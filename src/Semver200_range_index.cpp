@@ -0,0 +1,167 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include "semver200_range_index.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		const Semver200_key_codec codec;
+
+		/// Test if entry's upper bound lies above the key.
+		template<typename E>
+		inline bool below_upper(const E& e, const string& key) {
+			return !e.has_upper || key < e.upper;
+		}
+
+		/// Pick entry with higher upper bound; unbounded is the highest.
+		template<typename E>
+		inline bool higher_upper(const E& l, const E& r) {
+			if (!r.has_upper) return false;
+			return !l.has_upper || r.upper < l.upper;
+		}
+
+		inline bool same_normal(const int* n, const Version_data& v) {
+			return n[0] == v.major && n[1] == v.minor && n[2] == v.patch;
+		}
+	}
+
+	Semver200_range_index::Semver200_range_index() : shared_ids_{ 0 } {}
+
+	void Semver200_range_index::insert(const Id id, const Semver200_range& r) {
+		const size_t old_size = entries_.size();
+		append(id, r);
+		commit(old_size);
+	}
+
+	void Semver200_range_index::erase(const Id id) {
+		erase_ids(vector<Id>{ id });
+	}
+
+	vector<Semver200_range_index::Id> Semver200_range_index::find(const Version_data& v) const {
+		vector<Id> result;
+		find(v, result);
+		return result;
+	}
+
+	void Semver200_range_index::find(const Version_data& v, vector<Id>& out) const {
+		if (entries_.empty()) return;
+		const string key = codec.encode_precedence(v);
+		const size_t prefix = static_cast<size_t>(upper_bound(entries_.begin(), entries_.end(), key,
+			[](const string& k, const Entry& e) { return k < e.lower; }) - entries_.begin());
+		const size_t first = out.size();
+		collect(1, 0, entries_.size(), prefix, key, v, out);
+		if (shared_ids_ != 0) {
+			sort(out.begin() + first, out.end());
+			out.erase(unique(out.begin() + first, out.end()), out.end());
+		}
+	}
+
+	void Semver200_range_index::clear() {
+		entries_.clear();
+		tree_.clear();
+		entry_counts_.clear();
+		shared_ids_ = 0;
+	}
+
+	void Semver200_range_index::append(const Id id, const Semver200_range& r) {
+		for (const auto& iv : r.intervals()) {
+			Entry e;
+			if (iv.has_lower) e.lower = codec.encode_precedence(iv.lower);
+			if (iv.has_upper) e.upper = codec.encode_precedence(iv.upper);
+			e.id = id;
+			e.lower_normal[0] = iv.lower.major;
+			e.lower_normal[1] = iv.lower.minor;
+			e.lower_normal[2] = iv.lower.patch;
+			e.upper_normal[0] = iv.upper.major;
+			e.upper_normal[1] = iv.upper.minor;
+			e.upper_normal[2] = iv.upper.patch;
+			e.has_upper = iv.has_upper;
+			e.lower_prerelease = iv.lower_prerelease;
+			e.upper_prerelease = iv.upper_prerelease;
+			e.include_prerelease = r.include_prerelease();
+			entries_.push_back(move(e));
+			if (++entry_counts_[id] == 2) ++shared_ids_;
+		}
+	}
+
+	void Semver200_range_index::commit(const size_t old_size) {
+		auto by_lower = [](const Entry& l, const Entry& r) { return l.lower < r.lower; };
+		const auto middle = entries_.begin() + static_cast<ptrdiff_t>(old_size);
+		sort(middle, entries_.end(), by_lower);
+		inplace_merge(entries_.begin(), middle, entries_.end(), by_lower);
+		tree_.assign(entries_.empty() ? 0 : 4 * entries_.size(), 0);
+		if (!entries_.empty()) build(1, 0, entries_.size());
+	}
+
+	void Semver200_range_index::erase_ids(vector<Id> ids) {
+		sort(ids.begin(), ids.end());
+		ids.erase(unique(ids.begin(), ids.end()), ids.end());
+		for (const Id id : ids) {
+			const auto it = entry_counts_.find(id);
+			if (it == entry_counts_.end()) continue;
+			if (it->second > 1) --shared_ids_;
+			entry_counts_.erase(it);
+		}
+		entries_.erase(remove_if(entries_.begin(), entries_.end(), [&ids](const Entry& e) {
+			return binary_search(ids.begin(), ids.end(), e.id);
+		}), entries_.end());
+		commit(entries_.size());
+	}
+
+	void Semver200_range_index::build(const size_t node, const size_t l, const size_t r) {
+		if (r - l == 1) {
+			tree_[node] = l;
+			return;
+		}
+		const size_t mid = l + (r - l) / 2;
+		build(2 * node, l, mid);
+		build(2 * node + 1, mid, r);
+		const size_t a = tree_[2 * node];
+		const size_t b = tree_[2 * node + 1];
+		tree_[node] = higher_upper(entries_[a], entries_[b]) ? a : b;
+	}
+
+	void Semver200_range_index::collect(const size_t node, const size_t l, const size_t r, const size_t prefix,
+		const string& key, const Version_data& v, vector<Id>& out) const {
+		if (l >= prefix || !below_upper(entries_[tree_[node]], key)) return;
+		if (r - l == 1) {
+			const Entry& e = entries_[l];
+			// Prerelease versions are admitted only next to a bound with a prerelease, see Version_interval.
+			if (v.prerelease_ids.empty() || e.include_prerelease
+				|| (e.lower_prerelease && same_normal(e.lower_normal, v))
+				|| (e.upper_prerelease && same_normal(e.upper_normal, v))) {
+				out.push_back(e.id);
+			}
+			return;
+		}
+		const size_t mid = l + (r - l) / 2;
+		collect(2 * node, l, mid, prefix, key, v, out);
+		collect(2 * node + 1, mid, r, prefix, key, v, out);
+	}
+}
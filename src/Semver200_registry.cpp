@@ -0,0 +1,210 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include "semver200_hash.h"
+#include "semver200_registry.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		/// Initial number of package slots of each shard.
+		const size_t initial_capacity = 8;
+
+		const Semver200_registry::Snapshot& empty_snapshot() {
+			static const Semver200_registry::Snapshot empty = make_shared<const Semver200_registry::Versions>();
+			return empty;
+		}
+
+		/// Merge sorted additions into sorted versions, dropping versions identical to one already kept.
+		Semver200_registry::Versions merge_sorted(const Semver200_registry::Versions& versions,
+			Semver200_registry::Versions& added) {
+			const Semver200_exact_equal exact;
+			Semver200_registry::Versions merged;
+			merged.reserve(versions.size() + added.size());
+			merge(versions.begin(), versions.end(), make_move_iterator(added.begin()), make_move_iterator(added.end()),
+				back_inserter(merged));
+			auto out = merged.begin();
+			for (auto it = merged.begin(); it != merged.end(); ++it) {
+				// Identical versions have equal precedence, so only the run of equal ones kept last is searched.
+				bool duplicate = false;
+				for (auto kept = out; kept != merged.begin() && !duplicate;) {
+					--kept;
+					if (*kept < *it) break;
+					duplicate = exact(*kept, *it);
+				}
+				if (duplicate) continue;
+				if (out != it) *out = move(*it);
+				++out;
+			}
+			merged.erase(out, merged.end());
+			return merged;
+		}
+	}
+
+	Semver200_registry::Table::Table(const size_t capacity)
+		: mask{ capacity - 1 }, size{ 0 }, slots{ new atomic<Package*>[capacity] } {
+		for (size_t i = 0; i < capacity; ++i) slots[i].store(nullptr, memory_order_relaxed);
+	}
+
+	Semver200_registry::Semver200_registry(const size_t shards)
+		: shards_{ new Shard[shards ? shards : 1] }, shard_count_{ shards ? shards : 1 } {
+		for (size_t i = 0; i < shard_count_; ++i) shards_[i].packages.store(new Table(initial_capacity));
+	}
+
+	Semver200_registry::~Semver200_registry() {
+		for (size_t i = 0; i < shard_count_; ++i) {
+			Shard& s = shards_[i];
+			for (const Retired& r : s.retired) r.destroy(r.object);
+			Table* t = s.packages.load();
+			for (size_t j = 0; j <= t->mask; ++j) delete t->slots[j].load();
+			delete t;
+		}
+	}
+
+	bool Semver200_registry::insert(const string& package, const Semver200_version& v) {
+		return insert_batch(package, Versions(1, v)) == 1;
+	}
+
+	Semver200_registry::Snapshot Semver200_registry::versions(const string& package) const {
+		const size_t h = hash<string>()(package);
+		Epoch_domain::Read_guard guard(epochs_);
+		const Package* p = find(package, h);
+		return p ? *p->versions.load() : empty_snapshot();
+	}
+
+	shared_ptr<const Semver200_version> Semver200_registry::max_satisfying(const string& package,
+		const Semver200_range& r) const {
+		const size_t h = hash<string>()(package);
+		Epoch_domain::Read_guard guard(epochs_);
+		const Package* p = find(package, h);
+		if (!p) return nullptr;
+		const Snapshot& s = *p->versions.load();
+		const auto less = [](const Semver200_version& v, const Version_data& d) {
+			return Semver200_comparator().compare(v.data(), d) < 0;
+		};
+		const Semver200_version* best = nullptr;
+		for (const auto& iv : r.intervals()) {
+			auto lo = iv.has_lower ? lower_bound(s->begin(), s->end(), iv.lower, less) : s->begin();
+			auto it = iv.has_upper ? lower_bound(s->begin(), s->end(), iv.upper, less) : s->end();
+			// Walk down from the top of the interval, skipping prereleases the range does not admit.
+			while (it != lo) {
+				--it;
+				if (r.satisfies(it->data())) {
+					if (!best || *best < *it) best = &*it;
+					break;
+				}
+			}
+		}
+		// Only the snapshot's reference count is shared; it is raised before the guard lets the pointer go.
+		return best ? shared_ptr<const Semver200_version>(s, best) : nullptr;
+	}
+
+	Semver200_registry::Shard& Semver200_registry::shard(const size_t h) const {
+		return shards_[h % shard_count_];
+	}
+
+	Semver200_registry::Package* Semver200_registry::find(const string& package, const size_t h) const {
+		const Table* t = shard(h).packages.load();
+		// Low bits of the hash select the shard, so slots are indexed by the remaining ones.
+		for (size_t i = (h / shard_count_) & t->mask;; i = (i + 1) & t->mask) {
+			Package* p = t->slots[i].load(memory_order_acquire);
+			if (!p) return nullptr;
+			if (p->hash == h && p->name == package) return p;
+		}
+	}
+
+	size_t Semver200_registry::insert_batch(const string& package, Versions added) {
+		stable_sort(added.begin(), added.end());
+		const size_t h = hash<string>()(package);
+		Shard& s = shard(h);
+		lock_guard<mutex> lock(s.write);
+		// Room for what this insert retires, so nothing can fail once a replacement is published.
+		if (s.retired.size() == s.retired.capacity()) s.retired.reserve(2 * s.retired.size() + 1);
+
+		// Tables and snapshots of the shard are replaced only under its mutex, so no read guard is needed.
+		Package* p = find(package, h);
+		const Snapshot* old = p ? p->versions.load() : &empty_snapshot();
+		unique_ptr<const Snapshot> merged(new Snapshot(make_shared<const Versions>(merge_sorted(**old, added))));
+		const size_t count = (*merged)->size() - (*old)->size();
+		if (count == 0) return 0;
+
+		if (p) {
+			p->versions.store(merged.release());
+			retire(s, old);
+		} else {
+			// New package becomes visible only with its versions in place.
+			unique_ptr<Package> created(new Package(package, h));
+			created->versions.store(merged.release());
+			add_package(s, created.get());
+			created.release();
+		}
+		reclaim(s);
+		return count;
+	}
+
+	void Semver200_registry::add_package(Shard& s, Package* p) {
+		Table* t = s.packages.load(memory_order_relaxed);
+		if (2 * (t->size + 1) <= t->mask + 1) {
+			place(*t, p);
+			return;
+		}
+		unique_ptr<Table> grown(new Table(2 * (t->mask + 1)));
+		for (size_t i = 0; i <= t->mask; ++i) {
+			if (Package* q = t->slots[i].load(memory_order_relaxed)) place(*grown, q);
+		}
+		place(*grown, p);
+		s.packages.store(grown.release());
+		retire(s, static_cast<const Table*>(t));
+	}
+
+	void Semver200_registry::place(Table& t, Package* p) const {
+		size_t i = (p->hash / shard_count_) & t.mask;
+		while (t.slots[i].load(memory_order_relaxed)) i = (i + 1) & t.mask;
+		t.slots[i].store(p, memory_order_release);
+		++t.size;
+	}
+
+	template<typename T>
+	void Semver200_registry::retire(Shard& s, const T* object) {
+		// Epoch is read after the replacement is published: readers of any later epoch cannot see object.
+		s.retired.push_back(Retired{ epochs_.epoch(), object, [](const void* o) { delete static_cast<const T*>(o); } });
+	}
+
+	void Semver200_registry::reclaim(Shard& s) {
+		const uint64_t e = epochs_.advance();
+		auto kept = s.retired.begin();
+		for (const Retired& r : s.retired) {
+			if (Epoch_domain::expired(r.epoch, e)) r.destroy(r.object);
+			else *kept++ = r;
+		}
+		s.retired.erase(kept, s.retired.end());
+	}
+}
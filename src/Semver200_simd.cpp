@@ -0,0 +1,203 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <atomic>
+#include "semver200_dfa.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SEMVER_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 code is compiled with function-level target attribute, so the rest of the library keeps baseline
+// instruction set requirements; that attribute is only available in GCC and Clang.
+#if defined(SEMVER_HAVE_SSE2) && defined(__GNUC__)
+#define SEMVER_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace version {
+	namespace dfa {
+
+		namespace {
+
+			inline unsigned count_trailing_zeros(const unsigned mask) {
+#ifdef _MSC_VER
+				unsigned long idx;
+				_BitScanForward(&idx, mask);
+				return idx;
+#else
+				return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+			}
+
+#ifdef SEMVER_HAVE_SSE2
+			/// Mark bytes of v that belong to [0-9A-Za-z-]. Comparisons are signed, so bytes >= 0x80 are negative
+			/// and fall outside every range.
+			inline __m128i identifier_mask(const __m128i v) {
+				const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+					_mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+				// Setting bit 5 maps 'A'-'Z' onto 'a'-'z' and no other byte lands in that range.
+				const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+				const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+					_mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), lower));
+				const __m128i hyphen = _mm_cmpeq_epi8(v, _mm_set1_epi8('-'));
+				return _mm_or_si128(_mm_or_si128(digit, alpha), hyphen);
+			}
+
+			// Bitmask of bytes in 16-byte block starting at p that are not identifier characters.
+			inline unsigned sse2_bad_bytes(const char* p) {
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				return ~static_cast<unsigned>(_mm_movemask_epi8(identifier_mask(v))) & 0xffffu;
+			}
+
+			const char* skip_sse2(const char* b, const char* e) {
+				if (e - b < 16) return Scalar_skipper::skip(b, e);
+				for (; e - b >= 16; b += 16) {
+					const unsigned bad = sse2_bad_bytes(b);
+					if (bad) return b + count_trailing_zeros(bad);
+				}
+				if (b == e) return e;
+				// Check the tail with one more load that ends exactly at e, overlapping bytes already checked.
+				const char* last = e - 16;
+				const unsigned bad = sse2_bad_bytes(last) >> (b - last);
+				return bad ? b + count_trailing_zeros(bad) : e;
+			}
+#endif
+
+#ifdef SEMVER_HAVE_AVX2
+			__attribute__((target("avx2")))
+			inline unsigned avx2_bad_bytes(const char* p) {
+				const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+					_mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+				const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+				const __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+					_mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+				const __m256i hyphen = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('-'));
+				const __m256i ok = _mm256_or_si256(_mm256_or_si256(digit, alpha), hyphen);
+				return ~static_cast<unsigned>(_mm256_movemask_epi8(ok));
+			}
+
+			// Same as sse2_bad_bytes, but compiled for AVX2 so the 128-bit operations are VEX-encoded.
+			__attribute__((target("avx2")))
+			inline unsigned avx2_bad_bytes_16(const char* p) {
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+					_mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+				const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+				const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+					_mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), lower));
+				const __m128i hyphen = _mm_cmpeq_epi8(v, _mm_set1_epi8('-'));
+				const __m128i ok = _mm_or_si128(_mm_or_si128(digit, alpha), hyphen);
+				return ~static_cast<unsigned>(_mm_movemask_epi8(ok)) & 0xffffu;
+			}
+
+			// Runs of 16-31 bytes and the tail are handled with VEX-encoded loads (overlapping the bytes already
+			// checked) rather than by falling back to SSE2 code: mixing legacy SSE and 256-bit AVX instructions
+			// stalls some CPUs badly.
+			__attribute__((target("avx2")))
+			const char* skip_avx2(const char* b, const char* e) {
+				if (e - b < 16) return Scalar_skipper::skip(b, e);
+				if (e - b < 32) {
+					unsigned bad = avx2_bad_bytes_16(b);
+					if (bad) return b + count_trailing_zeros(bad);
+					const char* last = e - 16;
+					bad = avx2_bad_bytes_16(last);
+					return bad ? last + count_trailing_zeros(bad) : e;
+				}
+				for (; e - b >= 32; b += 32) {
+					const unsigned bad = avx2_bad_bytes(b);
+					if (bad) return b + count_trailing_zeros(bad);
+				}
+				if (b == e) return e;
+				const char* last = e - 32;
+				const unsigned bad = avx2_bad_bytes(last) >> (b - last);
+				return bad ? b + count_trailing_zeros(bad) : e;
+			}
+#endif
+
+			Simd_level detect_simd_level() {
+#ifdef SEMVER_HAVE_AVX2
+				__builtin_cpu_init();
+				if (__builtin_cpu_supports("avx2")) return Simd_level::avx2;
+#endif
+#ifdef SEMVER_HAVE_SSE2
+				return Simd_level::sse2;
+#else
+				return Simd_level::scalar;
+#endif
+			}
+
+			using Skip_function = const char* (*)(const char*, const char*);
+
+			const char* skip_resolve(const char*, const char*);
+
+			// Starts out pointing to resolver, which is constant-initialized, so the skipper is usable even
+			// while other translation units are being statically initialized.
+			std::atomic<Skip_function> skip_impl{ skip_resolve };
+
+			Skip_function select(const Simd_level level) {
+				switch (level) {
+#ifdef SEMVER_HAVE_AVX2
+				case Simd_level::avx2:
+					return skip_avx2;
+#endif
+#ifdef SEMVER_HAVE_SSE2
+				case Simd_level::sse2:
+					return skip_sse2;
+#endif
+				default:
+					return Scalar_skipper::skip;
+				}
+			}
+
+			const char* skip_resolve(const char* b, const char* e) {
+				Skip_function f = select(simd_level());
+				skip_impl.store(f, std::memory_order_relaxed);
+				return f(b, e);
+			}
+		}
+
+		Simd_level simd_level() {
+			static const Simd_level level = detect_simd_level();
+			return level;
+		}
+
+		const char* skip_identifier_chars(const char* b, const char* e) {
+			// Short runs are cheaper to walk directly than to dispatch.
+			if (e - b < 16) return Scalar_skipper::skip(b, e);
+			return skip_impl.load(std::memory_order_relaxed)(b, e);
+		}
+
+		const char* skip_identifier_chars(const char* b, const char* e, const Simd_level level) {
+			if (static_cast<int>(level) > static_cast<int>(simd_level())) return Scalar_skipper::skip(b, e);
+			return select(level)(b, e);
+		}
+	}
+}
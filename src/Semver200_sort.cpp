@@ -0,0 +1,219 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "semver200_sort.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		/// Precedence key: high holds major and minor, low holds (patch, release flag) and original position.
+		struct Sort_key {
+			uint64_t high;
+			uint64_t low;
+		};
+
+		const int key_bytes = 12; // Bytes of the key that carry precedence; the rest is the position.
+		const size_t small_bucket = 64;
+
+		inline bool key_less(const Sort_key& l, const Sort_key& r) {
+			return l.high < r.high || (l.high == r.high && l.low < r.low);
+		}
+
+		inline unsigned key_byte(const Sort_key& k, const int pos) {
+			return pos < 8 ? (k.high >> (56 - 8 * pos)) & 0xff : (k.low >> (56 - 8 * (pos - 8))) & 0xff;
+		}
+
+		inline uint32_t position(const Sort_key& k) {
+			return static_cast<uint32_t>(k.low);
+		}
+
+		/// Test if keys have equal precedence prefix and belong to prereleases.
+		inline bool prerelease_tie(const Sort_key& l, const Sort_key& r) {
+			return l.high == r.high && (l.low >> 32) == (r.low >> 32) && ((l.low >> 32) & 1) == 0;
+		}
+
+		inline const Version_data& data_of(const Semver200_version& v) {
+			return v.data();
+		}
+
+		inline const Version_data& data_of(const Version_data& v) {
+			return v;
+		}
+
+		unsigned worker_count(const Sort_options& o, const size_t n) {
+			unsigned t = o.threads ? o.threads : thread::hardware_concurrency();
+			if (t == 0) t = 1;
+			// Threads are not worth starting for small inputs.
+			return n < 8192 ? 1 : t;
+		}
+
+		/// Run f(begin, end) over equal chunks of [0, n) on given number of threads.
+		template<typename F>
+		void parallel_chunks(const unsigned threads, const size_t n, F f) {
+			if (threads <= 1) {
+				f(size_t{ 0 }, n);
+				return;
+			}
+			vector<thread> pool;
+			const size_t chunk = (n + threads - 1) / threads;
+			for (unsigned t = 1; t < threads && t * chunk < n; ++t) {
+				pool.emplace_back(f, t * chunk, min(n, (t + 1) * chunk));
+			}
+			f(size_t{ 0 }, min(n, chunk));
+			for (auto& th : pool) th.join();
+		}
+
+		/// Run f(i) for every task index in [0, n), handing tasks out to threads dynamically.
+		template<typename F>
+		void parallel_tasks(const unsigned threads, const size_t n, F f) {
+			atomic<size_t> next{ 0 };
+			auto worker = [&]() {
+				for (size_t i = next++; i < n; i = next++) f(i);
+			};
+			vector<thread> pool;
+			for (unsigned t = 1; t < threads && t < n; ++t) pool.emplace_back(worker);
+			worker();
+			for (auto& th : pool) th.join();
+		}
+
+		/// Stable MSD radix sort of keys on bytes starting at pos; buf is scratch space of the same size.
+		void radix_sort(Sort_key* keys, Sort_key* buf, const size_t n, int pos) {
+			for (; pos < key_bytes; ++pos) {
+				if (n <= small_bucket) {
+					// Position is part of the key, so this keeps equal versions in original order too.
+					sort(keys, keys + n, key_less);
+					return;
+				}
+				size_t count[256] = {};
+				for (size_t i = 0; i < n; ++i) ++count[key_byte(keys[i], pos)];
+				if (count[key_byte(keys[0], pos)] == n) continue;
+
+				size_t offset[256];
+				size_t sum = 0;
+				for (int b = 0; b < 256; ++b) {
+					offset[b] = sum;
+					sum += count[b];
+				}
+				for (size_t i = 0; i < n; ++i) buf[offset[key_byte(keys[i], pos)]++] = keys[i];
+				copy(buf, buf + n, keys);
+
+				size_t start = 0;
+				for (int b = 0; b < 256; ++b) {
+					if (count[b] > 1) radix_sort(keys + start, buf + start, count[b], pos + 1);
+					start += count[b];
+				}
+				return;
+			}
+		}
+
+		/// Order runs of prerelease keys with equal major.minor.patch by their prerelease identifiers.
+		template<typename T>
+		void sort_prerelease_ties(Sort_key* keys, const size_t n, const vector<T>& v, const bool stable) {
+			const Semver200_comparator comparator;
+			auto less = [&](const Sort_key& l, const Sort_key& r) {
+				return comparator.compare(data_of(v[position(l)]), data_of(v[position(r)])) < 0;
+			};
+			for (size_t i = 0; i < n;) {
+				size_t j = i + 1;
+				while (j < n && prerelease_tie(keys[i], keys[j])) ++j;
+				if (j - i > 1) {
+					if (stable) stable_sort(keys + i, keys + j, less);
+					else sort(keys + i, keys + j, less);
+				}
+				i = j;
+			}
+		}
+
+		template<typename T>
+		void sort_elements(vector<T>& v, const Sort_options& o) {
+			const size_t n = v.size();
+			if (n < 2) return;
+			if (n > UINT32_MAX) throw length_error("too many versions to sort");
+			const unsigned threads = worker_count(o, n);
+
+			vector<Sort_key> keys(n);
+			vector<Sort_key> buf(n);
+			parallel_chunks(threads, n, [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) {
+					const Version_data& d = data_of(v[i]);
+					const uint64_t release = d.prerelease_ids.empty() ? 1 : 0;
+					keys[i].high = static_cast<uint64_t>(static_cast<uint32_t>(d.major)) << 32
+						| static_cast<uint32_t>(d.minor);
+					keys[i].low = ((static_cast<uint64_t>(static_cast<uint32_t>(d.patch)) << 1 | release) << 32) | i;
+				}
+			});
+
+			// Find the first byte that distinguishes keys and split on it; buckets are then sorted independently.
+			vector<pair<size_t, size_t>> buckets;
+			int pos = 0;
+			for (; pos < key_bytes && buckets.empty(); ++pos) {
+				size_t count[256] = {};
+				for (const auto& k : keys) ++count[key_byte(k, pos)];
+				if (count[key_byte(keys[0], pos)] == n) continue;
+				size_t offset[256];
+				size_t sum = 0;
+				for (int b = 0; b < 256; ++b) {
+					offset[b] = sum;
+					if (count[b]) buckets.emplace_back(sum, count[b]);
+					sum += count[b];
+				}
+				for (const auto& k : keys) buf[offset[key_byte(k, pos)]++] = k;
+				keys.swap(buf);
+			}
+			if (buckets.empty()) buckets.emplace_back(0, n);
+			sort(buckets.begin(), buckets.end(), [](const pair<size_t, size_t>& l, const pair<size_t, size_t>& r) {
+				return l.second > r.second;
+			});
+
+			parallel_tasks(threads, buckets.size(), [&](const size_t t) {
+				Sort_key* k = keys.data() + buckets[t].first;
+				const size_t count = buckets[t].second;
+				radix_sort(k, buf.data() + buckets[t].first, count, pos);
+				sort_prerelease_ties(k, count, v, o.stable);
+			});
+
+			vector<T> sorted;
+			sorted.reserve(n);
+			for (const auto& k : keys) sorted.push_back(move(v[position(k)]));
+			v.swap(sorted);
+		}
+	}
+
+	void sort_versions(vector<Semver200_version>& v, const Sort_options& o) {
+		sort_elements(v, o);
+	}
+
+	void sort_versions(vector<Version_data>& v, const Sort_options& o) {
+		sort_elements(v, o);
+	}
+}
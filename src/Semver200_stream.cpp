@@ -0,0 +1,198 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include "semver200_stream.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SEMVER_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+
+		const size_t chunk_size = 64 * 1024;
+
+#ifdef SEMVER_HAVE_MMAP
+		/// Window mapped at once; a multiple of any page size in use.
+		const size_t window_size = 64 * 1024 * 1024;
+
+		/// File descriptor closed on scope exit.
+		struct File {
+			explicit File(const int f) : fd{ f } {}
+			File(const File&) = delete;
+			File& operator=(const File&) = delete;
+			~File() { ::close(fd); }
+
+			int fd;
+		};
+
+		[[noreturn]] void throw_errno(const string& what) {
+			throw system_error(errno, generic_category(), what);
+		}
+#endif
+	}
+
+	const size_t Semver200_stream_parser::default_max_record_size;
+
+	Semver200_stream_parser::Semver200_stream_parser(Record_visitor& v, const char delimiter,
+		const size_t max_record_size)
+		: visitor_(v), delimiter_{ delimiter }, max_record_size_{ max_record_size }, overflow_{ false }, line_{ 0 },
+		position_{ 0 }, record_offset_{ 0 } {}
+
+	void Semver200_stream_parser::feed(const char* data, const size_t n) {
+		consume(data, n, false);
+	}
+
+	void Semver200_stream_parser::finish() {
+		if (!carry_.empty() || overflow_) {
+			record(carry_.data(), carry_.size());
+			carry_.clear();
+		}
+	}
+
+	void Semver200_stream_parser::feed_final(const char* data, const size_t n) {
+		consume(data, n, true);
+		finish();
+	}
+
+	void Semver200_stream_parser::consume(const char* data, const size_t n, const bool last) {
+		const char* p = data;
+		const char* const end = data + n;
+		while (p != end) {
+			const char* d = static_cast<const char*>(memchr(p, delimiter_, static_cast<size_t>(end - p)));
+			if (!d) {
+				if (last && carry_.empty() && !overflow_) {
+					record(p, static_cast<size_t>(end - p));
+				} else {
+					append(p, static_cast<size_t>(end - p));
+				}
+				break;
+			}
+			if (carry_.empty() && !overflow_) {
+				record(p, static_cast<size_t>(d - p));
+			} else {
+				append(p, static_cast<size_t>(d - p));
+				record(carry_.data(), carry_.size());
+				carry_.clear();
+			}
+			p = d + 1;
+			record_offset_ = position_ + static_cast<size_t>(p - data);
+		}
+		position_ += n;
+	}
+
+	void Semver200_stream_parser::append(const char* p, const size_t n) {
+		const size_t room = max_record_size_ - carry_.size();
+		if (n > room) overflow_ = true;
+		carry_.insert(carry_.end(), p, p + min(n, room));
+	}
+
+	void Semver200_stream_parser::record(const char* p, size_t n) {
+		++line_;
+		if (overflow_ || n > max_record_size_) {
+			// Records are limited to the same size whether they were split between chunks or not.
+			overflow_ = false;
+			visitor_.error(Record_error{ line_, record_offset_, String_ref(p, min(n, max_record_size_)),
+				Parse_status{ Parse_errc::ok, 0, '\0' }, true });
+			return;
+		}
+		if (delimiter_ == '\n' && n > 0 && p[n - 1] == '\r') --n;
+		if (n == 0) return;
+		Version_view v;
+		const Parse_status s = Semver200_parser().try_parse(p, n, v);
+		if (s) {
+			visitor_.version(v, line_);
+		} else {
+			visitor_.error(Record_error{ line_, record_offset_, String_ref(p, n), s, false });
+		}
+	}
+
+	void parse_version_file(const string& path, Record_visitor& visitor, const char delimiter) {
+#ifdef SEMVER_HAVE_MMAP
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) throw_errno("cannot open " + path);
+		File file(fd);
+		struct stat st;
+		if (::fstat(file.fd, &st) != 0) throw_errno("cannot stat " + path);
+
+		Semver200_stream_parser parser(visitor, delimiter);
+		if (!S_ISREG(st.st_mode)) {
+			// Pipes, FIFOs and procfs files report no meaningful size, so they are read in chunks instead.
+			vector<char> buf(chunk_size);
+			for (;;) {
+				const ssize_t n = ::read(file.fd, buf.data(), buf.size());
+				if (n == 0) break;
+				if (n < 0) {
+					if (errno == EINTR) continue;
+					throw_errno("cannot read " + path);
+				}
+				parser.feed(buf.data(), static_cast<size_t>(n));
+			}
+			parser.finish();
+			return;
+		}
+		const size_t size = static_cast<size_t>(st.st_size);
+		for (size_t offset = 0; offset < size; offset += window_size) {
+			const size_t n = min(window_size, size - offset);
+			void* p = ::mmap(nullptr, n, PROT_READ, MAP_PRIVATE, file.fd, static_cast<off_t>(offset));
+			if (p == MAP_FAILED) throw_errno("cannot map " + path);
+			::madvise(p, n, MADV_SEQUENTIAL);
+			try {
+				parser.feed(static_cast<const char*>(p), n);
+			} catch (...) {
+				::munmap(p, n);
+				throw;
+			}
+			::munmap(p, n);
+		}
+		parser.finish();
+#else
+		ifstream is(path, ios::binary);
+		if (!is) throw system_error(make_error_code(errc::no_such_file_or_directory), "cannot open " + path);
+		parse_version_stream(is, visitor, delimiter);
+#endif
+	}
+
+	void parse_version_stream(istream& is, Record_visitor& visitor, const char delimiter) {
+		Semver200_stream_parser parser(visitor, delimiter);
+		vector<char> buf(chunk_size);
+		while (is.read(buf.data(), static_cast<streamsize>(buf.size())) || is.gcount() > 0) {
+			parser.feed(buf.data(), static_cast<size_t>(is.gcount()));
+		}
+		if (is.bad()) throw system_error(make_error_code(errc::io_error), "cannot read version stream");
+		parser.finish();
+	}
+}
@@ -0,0 +1,164 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include "version_column.h"
+
+using namespace std;
+
+namespace version {
+
+	Version_column::Version_column() : offsets_(1, 0) {}
+
+	void Version_column::reserve(const size_type versions, const size_type text_bytes) {
+		major_.reserve(versions);
+		minor_.reserve(versions);
+		patch_.reserve(versions);
+		offsets_.reserve(2 * versions + 1);
+		text_.reserve(text_bytes);
+	}
+
+	void Version_column::clear() {
+		truncate(0);
+	}
+
+	void Version_column::shrink_to_fit() {
+		major_.shrink_to_fit();
+		minor_.shrink_to_fit();
+		patch_.shrink_to_fit();
+		offsets_.shrink_to_fit();
+		text_.shrink_to_fit();
+	}
+
+	Version_view Version_column::operator[](const size_type i) const {
+		const Offset pre = offsets_[2 * i];
+		const Offset build = offsets_[2 * i + 1];
+		const Offset end = offsets_[2 * i + 2];
+		return Version_view{ major_[i], minor_[i], patch_[i], String_ref(text_.data() + pre, build - pre),
+			String_ref(text_.data() + build, end - build) };
+	}
+
+	Version_data Version_column::data(const size_type i) const {
+		return (*this)[i].to_data();
+	}
+
+	void Version_column::push_back(const String_ref& s) {
+		auto status = try_push_back(s);
+		if (!status) throw Parse_error(error_message(status));
+	}
+
+	Parse_status Version_column::try_push_back(const String_ref& s) {
+		Version_view v{ 0, 0, 0, String_ref(), String_ref() };
+		auto status = parser_.try_parse(s.data, s.size, v);
+		if (status) push_back(v);
+		return status;
+	}
+
+	void Version_column::push_back(const Version_view& v) {
+		if (text_.size() + v.prerelease.size + v.build.size > numeric_limits<Offset>::max()) {
+			throw length_error("version column text exceeds 4 GiB");
+		}
+		String_ref prerelease = v.prerelease;
+		String_ref build = v.build;
+		const size_type original = size();
+		try {
+			const bool pre_inside = in_text(prerelease);
+			const bool build_inside = in_text(build);
+			if (pre_inside || build_inside) {
+				// View of an element of this column: make room first so appending cannot move the text it refers to.
+				const size_t pre_offset = pre_inside ? static_cast<size_t>(prerelease.data - text_.data()) : 0;
+				const size_t build_offset = build_inside ? static_cast<size_t>(build.data - text_.data()) : 0;
+				text_.reserve(text_.size() + prerelease.size + build.size);
+				if (pre_inside) prerelease.data = text_.data() + pre_offset;
+				if (build_inside) build.data = text_.data() + build_offset;
+			}
+			major_.push_back(v.major);
+			minor_.push_back(v.minor);
+			patch_.push_back(v.patch);
+			append_text(prerelease);
+			append_text(build);
+		} catch (...) {
+			// Arrays grow one after another; trim the ones that already did so they stay in step.
+			truncate(original);
+			throw;
+		}
+	}
+
+	void Version_column::push_back(const Version_data& v) {
+		string pre;
+		for (const auto& id : v.prerelease_ids) {
+			if (!pre.empty()) pre.push_back('.');
+			pre += id.first;
+		}
+		string build;
+		for (const auto& id : v.build_ids) {
+			if (!build.empty()) build.push_back('.');
+			build += id;
+		}
+		push_back(Version_view{ v.major, v.minor, v.patch, String_ref(pre), String_ref(build) });
+	}
+
+	void Version_column::append(const Version_column& c) {
+		if (&c == this) {
+			append(Version_column(c));
+			return;
+		}
+		if (text_.size() + c.text_.size() > numeric_limits<Offset>::max()) {
+			throw length_error("version column text exceeds 4 GiB");
+		}
+		const size_type original = size();
+		try {
+			major_.insert(major_.end(), c.major_.begin(), c.major_.end());
+			minor_.insert(minor_.end(), c.minor_.begin(), c.minor_.end());
+			patch_.insert(patch_.end(), c.patch_.begin(), c.patch_.end());
+			const Offset base = static_cast<Offset>(text_.size());
+			offsets_.reserve(offsets_.size() + c.offsets_.size() - 1);
+			for (size_type i = 1; i < c.offsets_.size(); ++i) offsets_.push_back(base + c.offsets_[i]);
+			text_ += c.text_;
+		} catch (...) {
+			truncate(original);
+			throw;
+		}
+	}
+
+	bool Version_column::in_text(const String_ref& s) const {
+		const less<const char*> before;
+		return s.size != 0 && !before(s.data, text_.data()) && before(s.data, text_.data() + text_.size());
+	}
+
+	void Version_column::append_text(const String_ref& s) {
+		text_.append(s.data, s.size);
+		offsets_.push_back(static_cast<Offset>(text_.size()));
+	}
+
+	void Version_column::truncate(const size_type n) {
+		major_.resize(n);
+		minor_.resize(n);
+		patch_.resize(n);
+		offsets_.resize(2 * n + 1);
+		text_.resize(offsets_.back());
+	}
+}
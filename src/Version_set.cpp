@@ -0,0 +1,117 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include "version_set.h"
+
+using namespace std;
+
+namespace version {
+
+	namespace {
+		const Semver200_parser parser;
+	}
+
+	Version_set::size_type Version_set::erase(const Version_data& v) {
+		auto it = set_.find(v);
+		if (it == set_.end()) return 0;
+		set_.erase(it);
+		return 1;
+	}
+
+	Version_set::const_iterator Version_set::find(const string& v) const {
+		return find(parser.parse(v));
+	}
+
+	Version_set::const_iterator Version_set::lower_bound(const string& v) const {
+		return lower_bound(parser.parse(v));
+	}
+
+	Version_set::const_iterator Version_set::upper_bound(const string& v) const {
+		return upper_bound(parser.parse(v));
+	}
+
+	Version_set::const_iterator Version_set::predecessor(const Version_data& v) const {
+		auto it = set_.lower_bound(v);
+		return it == set_.begin() ? set_.end() : --it;
+	}
+
+	Version_set::const_iterator Version_set::max_satisfying(const Semver200_range& r) const {
+		const Less less;
+		auto best = set_.end();
+		for (const auto& iv : r.intervals()) {
+			auto lo = iv.has_lower ? set_.lower_bound(iv.lower) : set_.begin();
+			auto it = iv.has_upper ? set_.lower_bound(iv.upper) : set_.end();
+			// Walk down from the top of the interval, skipping prereleases the range does not admit.
+			while (it != lo) {
+				--it;
+				if (r.satisfies(it->data())) {
+					if (best == set_.end() || less(*best, *it)) best = it;
+					break;
+				}
+			}
+		}
+		return best;
+	}
+
+	vector<Semver200_version> Version_set::satisfying(const Semver200_range& r) const {
+		const Less less;
+		vector<const Version_interval*> intervals;
+		for (const auto& iv : r.intervals()) intervals.push_back(&iv);
+		sort(intervals.begin(), intervals.end(), [](const Version_interval* a, const Version_interval* b) {
+			return b->has_lower && (!a->has_lower || Semver200_comparator().compare(a->lower, b->lower) < 0);
+		});
+
+		// Intervals may overlap, so every version is examined at most once by never going back below 'next'.
+		vector<Semver200_version> result;
+		auto next = set_.begin();
+		for (const auto* iv : intervals) {
+			if (next == set_.end()) break;
+			auto lo = iv->has_lower ? set_.lower_bound(iv->lower) : set_.begin();
+			auto hi = iv->has_upper ? set_.lower_bound(iv->upper) : set_.end();
+			if (lo == set_.end()) continue;
+			if (less(*lo, *next)) lo = next;
+			if (hi != set_.end() && !less(*lo, *hi)) continue;
+			for (; lo != hi; ++lo) {
+				if (r.satisfies(lo->data())) result.push_back(*lo);
+			}
+			next = hi;
+		}
+		return result;
+	}
+
+	void Version_set::insert_batch(vector<Semver200_version> batch) {
+		const Less less;
+		stable_sort(batch.begin(), batch.end(), less);
+		batch.erase(unique(batch.begin(), batch.end(), [&less](const Semver200_version& l, const Semver200_version& r) {
+			return !less(l, r);
+		}), batch.end());
+		if (set_.empty()) {
+			// Input is ascending, so hinted insertion at the end fills the tree in linear time.
+			for (auto& v : batch) set_.insert(set_.end(), move(v));
+		} else {
+			for (auto& v : batch) set_.insert(move(v));
+		}
+	}
+}
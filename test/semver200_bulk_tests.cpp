@@ -0,0 +1,109 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_bulk_tests
+
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_bulk.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	string describe(const size_t line, const Version_view& v) {
+		return to_string(line) + ":" + to_string(v.major) + "." + to_string(v.minor) + "." + to_string(v.patch) + "-"
+			+ v.prerelease.str() + "+" + v.build.str();
+	}
+
+	string describe(const Record_error& e) {
+		return "!" + to_string(e.line) + "+" + to_string(e.offset) + ":" + e.text.str() + "@" + to_string(e.status.offset);
+	}
+
+	/// Reference output of the sequential stream parser.
+	struct Collector : Record_visitor {
+		void version(const Version_view& v, const size_t line) override { versions.push_back(describe(line, v)); }
+		void error(const Record_error& e) override { errors.push_back(describe(e)); }
+
+		vector<string> versions;
+		vector<string> errors;
+	};
+
+	void check_bulk(const string& input, const char delimiter = '\n') {
+		Collector expected;
+		Semver200_stream_parser sp(expected, delimiter);
+		sp.feed(input.data(), input.size());
+		sp.finish();
+
+		for (const unsigned threads : { 1u, 2u, 3u, 8u }) {
+			for (const size_t chunk : { size_t{ 1 }, size_t{ 7 }, size_t{ 64 }, size_t{ 1 } << 20 }) {
+				Bulk_options o;
+				o.threads = threads;
+				o.chunk_size = chunk;
+				o.delimiter = delimiter;
+				const Bulk_result r = parse_versions_bulk(input.data(), input.size(), o);
+				BOOST_REQUIRE_EQUAL(r.versions.size(), r.lines.size());
+				vector<string> versions, errors;
+				for (size_t i = 0; i < r.versions.size(); ++i) versions.push_back(describe(r.lines[i], r.versions[i]));
+				for (const auto& e : r.errors) errors.push_back(describe(e));
+				BOOST_CHECK(versions == expected.versions);
+				BOOST_CHECK_EQUAL_COLLECTIONS(errors.begin(), errors.end(), expected.errors.begin(), expected.errors.end());
+				BOOST_CHECK_EQUAL(r.records, sp.lines());
+			}
+		}
+	}
+}
+
+// any thread count and chunk size reproduces sequential results in input order
+BOOST_AUTO_TEST_CASE(bulk_matches_stream) {
+	string input;
+	for (int i = 0; i < 500; ++i) {
+		input += to_string(i % 7) + "." + to_string(i) + ".0";
+		if (i % 5 == 0) input += "-rc." + to_string(i % 3);
+		if (i % 11 == 0) input += "+b" + to_string(i);
+		if (i % 13 == 0) input += ".";
+		input += i % 17 == 0 ? "\r\n\n" : "\n";
+	}
+	check_bulk(input);
+	check_bulk(input + "9.9.9");
+}
+
+BOOST_AUTO_TEST_CASE(bulk_edge_cases) {
+	check_bulk("");
+	check_bulk("\n\n\n");
+	check_bulk("1.2.3");
+	check_bulk("x");
+	check_bulk(string("1.2.3\0" "1.2\0" "4.5.6", 15), '\0');
+
+	const string s = "1.2.3\n1.2\n2.0.0-rc.1\n";
+	const Bulk_result r = parse_versions_bulk(s.data(), s.size());
+	BOOST_REQUIRE_EQUAL(r.versions.size(), 2);
+	BOOST_CHECK_EQUAL(r.versions[1].prerelease.str(), "rc.1");
+	BOOST_CHECK(r.lines == vector<size_t>({ 1, 3 }));
+	BOOST_REQUIRE_EQUAL(r.errors.size(), 1);
+	BOOST_CHECK_EQUAL(r.errors[0].line, 2);
+	BOOST_CHECK_EQUAL(r.errors[0].offset, 6);
+	BOOST_CHECK(r.errors[0].status.code == Parse_errc::unexpected_end);
+}
@@ -0,0 +1,183 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_column_tests
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "version_column.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	// Number of allocations that succeed before operator new throws; negative means unlimited.
+	long allocations_left = -1;
+}
+
+// Replacements are kept out of line: once free() is inlined into callers, GCC pairs it with the
+// builtin operator new and reports a mismatched deallocation.
+#ifdef __GNUC__
+#define SEMVER_NOINLINE __attribute__((noinline))
+#else
+#define SEMVER_NOINLINE
+#endif
+
+void* operator new(size_t n) {
+	if (allocations_left == 0) throw bad_alloc();
+	if (allocations_left > 0) --allocations_left;
+	if (void* ptr = malloc(n ? n : 1)) return ptr;
+	throw bad_alloc();
+}
+
+SEMVER_NOINLINE void operator delete(void* ptr) noexcept {
+	free(ptr);
+}
+
+SEMVER_NOINLINE void operator delete(void* ptr, size_t) noexcept {
+	free(ptr);
+}
+
+Semver200_comparator c;
+
+// bulk parse fills numeric arrays and identifier arena
+BOOST_AUTO_TEST_CASE(column_parse_all) {
+	const vector<string> src = { "1.2.3", "4.5.6-rc.1", "7.8.9+build.5", "10.11.12-alpha.beta+exp.sha.5114f85" };
+	Version_column col;
+	col.parse_all(src.begin(), src.end());
+	BOOST_REQUIRE_EQUAL(col.size(), 4u);
+	BOOST_CHECK_EQUAL(col.majors()[1], 4);
+	BOOST_CHECK_EQUAL(col.minors()[2], 8);
+	BOOST_CHECK_EQUAL(col.patches()[3], 12);
+	BOOST_CHECK(col[0].prerelease.empty());
+	BOOST_CHECK(col[0].build.empty());
+	BOOST_CHECK_EQUAL(col[1].prerelease.str(), "rc.1");
+	BOOST_CHECK(col[1].build.empty());
+	BOOST_CHECK(col[2].prerelease.empty());
+	BOOST_CHECK_EQUAL(col[2].build.str(), "build.5");
+	BOOST_CHECK_EQUAL(col[3].prerelease.str(), "alpha.beta");
+	BOOST_CHECK_EQUAL(col[3].build.str(), "exp.sha.5114f85");
+
+	for (size_t i = 0; i < src.size(); ++i) {
+		auto d = col.data(i);
+		auto e = p.parse(src[i]);
+		BOOST_CHECK_EQUAL(d.prerelease_ids, e.prerelease_ids);
+		BOOST_CHECK_EQUAL(d.build_ids, e.build_ids);
+		BOOST_CHECK_EQUAL(c.compare(col[i], p.parse_view(src[i].data(), src[i].size())), 0);
+	}
+}
+
+// invalid input leaves column unchanged
+BOOST_AUTO_TEST_CASE(column_parse_all_rollback) {
+	Version_column col;
+	col.push_back("1.0.0-x");
+	const vector<string> src = { "2.0.0-y", "3.0.0+z", "bad" };
+	BOOST_CHECK_THROW(col.parse_all(src.begin(), src.end()), Parse_error);
+	BOOST_REQUIRE_EQUAL(col.size(), 1u);
+	BOOST_CHECK_EQUAL(col[0].prerelease.str(), "x");
+
+	BOOST_CHECK(col.try_push_back("1.2").code == Parse_errc::unexpected_end);
+	BOOST_CHECK_EQUAL(col.size(), 1u);
+	col.push_back("4.0.0+w");
+	BOOST_CHECK_EQUAL(col[1].build.str(), "w");
+}
+
+// already parsed versions can be appended
+BOOST_AUTO_TEST_CASE(column_push_parsed) {
+	Version_column col;
+	col.push_back(p.parse("1.2.3-a.1+b.2"));
+	const string s = "3.2.1-x";
+	col.push_back(p.parse_view(s.data(), s.size()));
+	BOOST_CHECK_EQUAL(col[0].prerelease.str(), "a.1");
+	BOOST_CHECK_EQUAL(col[0].build.str(), "b.2");
+	BOOST_CHECK_EQUAL(col[1].major, 3);
+	BOOST_CHECK_EQUAL(col[1].prerelease.str(), "x");
+
+	col.clear();
+	BOOST_CHECK(col.empty());
+	col.push_back("0.0.1");
+	BOOST_CHECK_EQUAL(col.patch(0), 1);
+}
+
+// appending a column keeps text of both columns addressable
+BOOST_AUTO_TEST_CASE(column_append) {
+	const vector<string> first = { "1.0.0-a+x", "2.0.0" };
+	const vector<string> second = { "3.0.0+y.z", "4.0.0-b.1" };
+	Version_column a, b;
+	a.parse_all(first.begin(), first.end());
+	b.parse_all(second.begin(), second.end());
+	a.append(b);
+	a.append(a);
+	BOOST_REQUIRE_EQUAL(a.size(), 8);
+	for (size_t i = 0; i < a.size(); ++i) {
+		const string& s = i % 4 < 2 ? first[i % 2] : second[i % 2];
+		BOOST_CHECK(c.compare(a.data(i), p.parse(s)) == 0);
+		BOOST_CHECK_EQUAL(a[i].build.str(), p.parse_view(s.data(), s.size()).build.str());
+	}
+}
+
+// appending a view of the column's own element copies its text even when the arena grows
+BOOST_AUTO_TEST_CASE(column_push_own_element) {
+	Version_column col;
+	col.push_back("1.0.0-alpha.beta+build.42");
+	col.push_back("2.0.0+only.build");
+	for (size_t i = 0; i < 200; ++i) col.push_back(col[i]);
+	BOOST_REQUIRE_EQUAL(col.size(), 202u);
+	for (size_t i = 0; i < col.size(); ++i) {
+		BOOST_CHECK_EQUAL(col[i].major, i % 2 ? 2 : 1);
+		BOOST_CHECK_EQUAL(col[i].prerelease.str(), i % 2 ? "" : "alpha.beta");
+		BOOST_CHECK_EQUAL(col[i].build.str(), i % 2 ? "only.build" : "build.42");
+	}
+}
+
+// failed allocation part way through growing the arrays leaves column unchanged
+BOOST_AUTO_TEST_CASE(column_bad_alloc_rollback) {
+	const string long_text = "2.0.0-alpha.beta.gamma.delta+build.0123456789abcdef";
+	const auto v = p.parse_view(long_text.data(), long_text.size());
+	for (long fail_at = 0; fail_at < 16; ++fail_at) {
+		Version_column col, other;
+		col.push_back("1.0.0-x");
+		other.push_back(long_text);
+		other.push_back("3.0.0");
+
+		allocations_left = fail_at;
+		bool pushed = true, appended = true;
+		try { col.push_back(v); } catch (const bad_alloc&) { pushed = false; }
+		try { col.append(other); } catch (const bad_alloc&) { appended = false; }
+		allocations_left = -1;
+
+		const size_t expected = 1 + (pushed ? 1 : 0) + (appended ? 2 : 0);
+		BOOST_REQUIRE_EQUAL(col.size(), expected);
+		BOOST_CHECK_EQUAL(col.minors().size(), expected);
+		BOOST_CHECK_EQUAL(col.patches().size(), expected);
+		BOOST_CHECK_EQUAL(col[0].prerelease.str(), "x");
+		if (pushed) BOOST_CHECK_EQUAL(col[1].build.str(), "build.0123456789abcdef");
+		if (appended) BOOST_CHECK_EQUAL(col[expected - 1].major, 3);
+		col.push_back("4.0.0+y");
+		BOOST_CHECK_EQUAL(col[expected].build.str(), "y");
+	}
+}
@@ -35,7 +35,10 @@ Semver200_parser p;
 inline int compare(const std::string& l, const std::string& r) {
 	auto lv = p.parse(l);
 	auto rv = p.parse(r);
-	return c.compare(lv, rv);
+	int result = c.compare(lv, rv);
+	// Direct string comparison must agree with comparison of parsed data
+	BOOST_CHECK_EQUAL(c.compare(l.data(), l.size(), r.data(), r.size()), result);
+	return result;
 }
 
 #define GT(L, R) BOOST_CHECK(compare(L, R) >  0)
@@ -103,3 +106,36 @@ BOOST_AUTO_TEST_CASE(compare_build) {
 	EQ("1.0.0+ZZZ", "1.0.0+build.1.2.3");
 	EQ("1.0.0+100", "1.0.0+200");
 }
+
+// numeric ids are compared by value regardless of their length
+BOOST_AUTO_TEST_CASE(compare_long_numeric_prerels) {
+	GT("1.0.0-10000000000000000000", "1.0.0-9999999999999999999");
+	GT("1.0.0-123456789012345678901234567890", "1.0.0-123456789012345678901234567889");
+	EQ("1.0.0-rc.123456789012345678901234567890", "1.0.0-rc.123456789012345678901234567890");
+	LT("1.0.0-99999999999999999999999", "1.0.0-a");
+}
+
+// hand-made numeric ids with leading zeros are still compared by value
+BOOST_AUTO_TEST_CASE(compare_numeric_leading_zeros) {
+	Version_data l{ 1, 0, 0, { { "007", Id_type::num } }, {} };
+	Version_data r{ 1, 0, 0, { { "7", Id_type::num } }, {} };
+	Version_data g{ 1, 0, 0, { { "10", Id_type::num } }, {} };
+	BOOST_CHECK_EQUAL(c.compare(l, r), 0);
+	BOOST_CHECK_EQUAL(c.compare(l, g), -1);
+	BOOST_CHECK_EQUAL(c.compare(g, l), 1);
+}
+
+// string comparison validates both operands
+BOOST_AUTO_TEST_CASE(compare_strings_invalid) {
+	BOOST_CHECK_THROW(c.compare(std::string("1.2.3"), std::string("1.2")), Parse_error);
+	BOOST_CHECK_THROW(c.compare(std::string("2.0.0-"), std::string("1.0.0")), Parse_error);
+	// invalid text after the first difference is still rejected
+	BOOST_CHECK_THROW(c.compare(std::string("1.0.0"), std::string("2.0.0-a..b")), Parse_error);
+
+	int result = 7;
+	BOOST_CHECK(c.try_compare("1.0.0", 5, "1.0.0-01", 8, result).code == Parse_errc::numeric_leading_zero);
+	BOOST_CHECK(c.try_compare("1.0", 3, "1.0.0", 5, result).code == Parse_errc::unexpected_end);
+	BOOST_CHECK_EQUAL(result, 7);
+	BOOST_CHECK(c.try_compare("1.0.0-rc.2", 10, "1.0.0-rc.10", 11, result));
+	BOOST_CHECK_EQUAL(result, -1);
+}
@@ -0,0 +1,95 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define BOOST_TEST_MODULE semver200_epoch_tests
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "epoch_domain.h"
+
+using namespace version;
+using namespace std;
+
+// object stamped while a reader is active expires only after that reader leaves
+BOOST_AUTO_TEST_CASE(epoch_guard_blocks_expiry) {
+	Epoch_domain d;
+	unique_ptr<Epoch_domain::Read_guard> reader(new Epoch_domain::Read_guard(d));
+	const auto stamp = d.epoch();
+	BOOST_CHECK(!Epoch_domain::expired(stamp, d.advance()));
+	BOOST_CHECK(!Epoch_domain::expired(stamp, d.advance()));
+	reader.reset();
+	BOOST_CHECK(Epoch_domain::expired(stamp, d.advance()));
+
+	// without readers, objects stamped now can be freed after a single advance
+	const auto now = d.epoch();
+	BOOST_CHECK(Epoch_domain::expired(now, d.advance()));
+}
+
+// readers never see an object after it was freed through the domain
+BOOST_AUTO_TEST_CASE(epoch_concurrent) {
+	struct Object {
+		explicit Object(const int v) : value{ v } {}
+		~Object() { value = -1; }
+		int value;
+	};
+	Epoch_domain d;
+	atomic<Object*> current{ new Object(0) };
+	atomic<bool> done{ false };
+	atomic<int> failures{ 0 };
+
+	vector<thread> readers;
+	for (int t = 0; t < 3; ++t) {
+		readers.emplace_back([&]() {
+			int last = 0;
+			while (!done.load()) {
+				Epoch_domain::Read_guard guard(d);
+				const int v = current.load()->value;
+				if (v < last) ++failures;
+				last = v;
+			}
+		});
+	}
+	vector<pair<uint64_t, Object*>> retired;
+	for (int i = 1; i <= 20000; ++i) {
+		Object* old = current.exchange(new Object(i));
+		retired.emplace_back(d.epoch(), old);
+		const auto e = d.advance();
+		auto kept = retired.begin();
+		for (const auto& r : retired) {
+			if (Epoch_domain::expired(r.first, e)) delete r.second;
+			else *kept++ = r;
+		}
+		retired.erase(kept, retired.end());
+	}
+	done = true;
+	for (auto& th : readers) th.join();
+	for (const auto& r : retired) delete r.second;
+	delete current.load();
+	BOOST_CHECK_EQUAL(failures.load(), 0);
+}
@@ -0,0 +1,86 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_hash_tests
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_hash.h"
+
+using namespace version;
+using namespace std;
+
+Semver200_hash h;
+Semver200_exact_hash eh;
+
+// hash agrees with precedence equality
+BOOST_AUTO_TEST_CASE(hash_precedence) {
+	BOOST_CHECK_EQUAL(h(p.parse("1.0.0+a")), h(p.parse("1.0.0+b.c")));
+	BOOST_CHECK_EQUAL(h(Semver200_version("1.0.0-rc.1+x")), h(Semver200_version("1.0.0-rc.1")));
+	BOOST_CHECK_EQUAL(std::hash<Semver200_version>()(Semver200_version("2.0.0+z")),
+		h(Semver200_version("2.0.0")));
+
+	// Hand-made numeric identifiers with leading zeros equal their canonical form
+	const Version_data zeros{ 1, 0, 0, Prerelease_identifiers{ { "rc", Id_type::alnum }, { "007", Id_type::num } },
+		Build_identifiers{} };
+	BOOST_CHECK(Semver200_equal()(zeros, p.parse("1.0.0-rc.7")));
+	BOOST_CHECK_EQUAL(h(zeros), h(p.parse("1.0.0-rc.7")));
+
+	// Different versions get different hashes
+	const vector<string> src = { "1.0.0", "1.0.1", "1.1.0", "0.1.0", "0.0.1", "1.0.0-0", "1.0.0-rc", "1.0.0-rc.1",
+		"1.0.0-rc.1.0", "1.0.0-1.rc", "1.0.0-rcx", "1.0.0-a.b", "1.0.0-a-b", "1.0.0-1", "1.0.0-10" };
+	unordered_set<size_t> hashes;
+	for (const auto& s : src) hashes.insert(h(p.parse(s)));
+	BOOST_CHECK_EQUAL(hashes.size(), src.size());
+}
+
+// exact hash distinguishes build metadata
+BOOST_AUTO_TEST_CASE(hash_exact) {
+	BOOST_CHECK(eh(p.parse("1.0.0+a")) != eh(p.parse("1.0.0+b")));
+	BOOST_CHECK(eh(p.parse("1.0.0+a.b")) != eh(p.parse("1.0.0+ab")));
+	BOOST_CHECK(eh(p.parse("1.0.0-a+b")) != eh(p.parse("1.0.0-a.b")));
+	BOOST_CHECK_EQUAL(eh(p.parse("1.0.0-a+b")), eh(Semver200_version("1.0.0-a+b")));
+	BOOST_CHECK(Semver200_exact_equal()(p.parse("1.0.0-a+b"), p.parse("1.0.0-a+b")));
+	BOOST_CHECK(!Semver200_exact_equal()(p.parse("1.0.0-a+b"), p.parse("1.0.0-a+c")));
+}
+
+// versions work as keys of unordered containers
+BOOST_AUTO_TEST_CASE(hash_containers) {
+	unordered_set<Semver200_version> by_precedence;
+	unordered_set<Version_data, Semver200_exact_hash, Semver200_exact_equal> exact;
+	unordered_map<Semver200_hashed_version, int> cached;
+	for (const string s : { "1.0.0", "1.0.0+a", "1.0.0+b", "1.0.0-rc.1", "1.0.0-rc.1+a", "2.0.0" }) {
+		by_precedence.insert(Semver200_version(s));
+		exact.insert(p.parse(s));
+		++cached[Semver200_hashed_version(Semver200_version(s))];
+	}
+	BOOST_CHECK_EQUAL(by_precedence.size(), 3u);
+	BOOST_CHECK_EQUAL(exact.size(), 6u);
+	BOOST_CHECK_EQUAL(cached.size(), 3u);
+	BOOST_CHECK_EQUAL(cached[Semver200_hashed_version(Semver200_version("1.0.0+zzz"))], 3);
+	BOOST_CHECK(by_precedence.count(Semver200_version("1.0.0-rc.1+other")) == 1);
+}
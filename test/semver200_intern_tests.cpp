@@ -0,0 +1,109 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_intern_tests
+
+#include <string>
+#include <thread>
+#include <vector>
+#include "semver200_parser_util.h"
+
+using namespace version;
+using namespace std;
+
+Semver200_comparator c;
+
+namespace {
+	Interned_version parse(const string& s, Identifier_pool& pool) {
+		return p.parse(s.data(), s.size(), pool);
+	}
+}
+
+// equal identifiers share storage
+BOOST_AUTO_TEST_CASE(intern_shares_storage) {
+	Identifier_pool pool;
+	auto a = parse("1.0.0-alpha.1+build.ci", pool);
+	auto b = parse("2.0.0-alpha.2+ci", pool);
+	BOOST_CHECK(a.prerelease_ids[0].first == b.prerelease_ids[0].first);
+	BOOST_CHECK(a.prerelease_ids[1].first != b.prerelease_ids[1].first);
+	BOOST_CHECK(a.build_ids[1] == b.build_ids[0]);
+	BOOST_CHECK(a.prerelease_ids[1].second == Id_type::num);
+	BOOST_CHECK(a.prerelease_ids[0].second == Id_type::alnum);
+	BOOST_CHECK_EQUAL(pool.size(), 5u);
+	BOOST_CHECK_EQUAL(a.build_ids[0].str(), "build");
+
+	auto d = a.to_data();
+	auto e = p.parse("1.0.0-alpha.1+build.ci");
+	BOOST_CHECK_EQUAL(d.prerelease_ids, e.prerelease_ids);
+	BOOST_CHECK_EQUAL(d.build_ids, e.build_ids);
+}
+
+// invalid input leaves output and pool unchanged
+BOOST_AUTO_TEST_CASE(intern_invalid) {
+	Identifier_pool pool;
+	Interned_version v{ 7, 0, 0, {}, {} };
+	BOOST_CHECK(p.try_parse("1.0.0-a..b", 10, v, pool).code == Parse_errc::empty_identifier);
+	BOOST_CHECK_EQUAL(v.major, 7);
+	BOOST_CHECK_THROW(p.parse("1.0", 3, pool), Parse_error);
+	const string bad = "1.2.3-alpha.beta.01+build.5";
+	BOOST_CHECK(p.try_parse(bad.data(), bad.size(), v, pool).code == Parse_errc::numeric_leading_zero);
+	const string bad_build = "1.2.3-rc.1+build.5#";
+	BOOST_CHECK(!p.try_parse(bad_build.data(), bad_build.size(), v, pool));
+	BOOST_CHECK_EQUAL(pool.size(), 0u);
+}
+
+// interned comparison agrees with Version_data comparison
+BOOST_AUTO_TEST_CASE(intern_compare) {
+	const vector<string> src = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta",
+		"1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1", "1.0.0", "1.0.0+b", "1.0.1-alpha" };
+	Identifier_pool pool;
+	for (const auto& l : src) {
+		for (const auto& r : src) {
+			BOOST_CHECK_EQUAL(c.compare(parse(l, pool), parse(r, pool)), c.compare(p.parse(l), p.parse(r)));
+		}
+	}
+}
+
+// thread-safe pool hands out one handle per text to all threads
+BOOST_AUTO_TEST_CASE(intern_concurrent) {
+	Identifier_pool pool(true);
+	BOOST_CHECK(pool.thread_safe());
+	vector<vector<Interned_version>> results(4);
+	vector<thread> threads;
+	for (size_t t = 0; t < results.size(); ++t) {
+		threads.emplace_back([&pool, &results, t]() {
+			for (int i = 0; i < 1000; ++i) {
+				results[t].push_back(parse("1.0.0-rc." + to_string(i % 50) + "+ci.main", pool));
+			}
+		});
+	}
+	for (auto& th : threads) th.join();
+	BOOST_CHECK_EQUAL(pool.size(), 53u);
+	for (size_t t = 1; t < results.size(); ++t) {
+		for (size_t i = 0; i < results[t].size(); ++i) {
+			BOOST_CHECK(results[t][i].prerelease_ids[1].first == results[0][i].prerelease_ids[1].first);
+			BOOST_CHECK(results[t][i].build_ids[1] == results[0][i].build_ids[1]);
+		}
+	}
+}
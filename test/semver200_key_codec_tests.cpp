@@ -0,0 +1,116 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_key_codec_tests
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+
+using namespace version;
+using namespace std;
+
+Semver200_comparator c;
+Semver200_key_codec k;
+
+inline int sign(const int v) {
+	return v == 0 ? 0 : v > 0 ? 1 : -1;
+}
+
+// byte order of keys matches semver precedence
+BOOST_AUTO_TEST_CASE(key_order_matches_precedence) {
+	const vector<string> versions = { "0.0.0", "0.0.1", "0.1.0", "1.0.0-0", "1.0.0-1", "1.0.0-2", "1.0.0-10",
+		"1.0.0-255", "1.0.0-99999999999999999999", "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.1.0",
+		"1.0.0-alpha.beta", "1.0.0-alpha-", "1.0.0-alpha0", "1.0.0-beta", "1.0.0-beta.2", "1.0.0-beta.11",
+		"1.0.0-rc.1", "1.0.0-Z", "1.0.0", "1.0.1", "1.10.0", "2.0.0", "255.255.255", "256.0.0",
+		"2147483647.0.0" };
+	for (const auto& l : versions) {
+		for (const auto& r : versions) {
+			auto lv = p.parse(l);
+			auto rv = p.parse(r);
+			BOOST_CHECK_EQUAL(sign(k.encode_precedence(lv).compare(k.encode_precedence(rv))), c.compare(lv, rv));
+			BOOST_CHECK_EQUAL(sign(k.encode(lv).compare(k.encode(rv))), c.compare(lv, rv));
+		}
+	}
+}
+
+// numeric ids longer than 254 digits use extended digit count
+BOOST_AUTO_TEST_CASE(key_long_numeric_ids) {
+	const string short_num = "1.0.0-" + string(254, '9');
+	const string long_num = "1.0.0-1" + string(254, '0');
+	const string longer_num = "1.0.0-1" + string(300, '0');
+	BOOST_CHECK(k.encode(p.parse(short_num)) < k.encode(p.parse(long_num)));
+	BOOST_CHECK(k.encode(p.parse(long_num)) < k.encode(p.parse(longer_num)));
+	BOOST_CHECK(k.encode(p.parse(longer_num)) < k.encode(p.parse("1.0.0-a")));
+	BOOST_CHECK_EQUAL(k.decode(k.encode(p.parse(longer_num))).prerelease_ids, p.parse(longer_num).prerelease_ids);
+}
+
+// build only breaks ties between versions of equal precedence
+BOOST_AUTO_TEST_CASE(key_build) {
+	auto a = p.parse("1.0.0+a");
+	auto b = p.parse("1.0.0+b");
+	BOOST_CHECK(k.encode(a) < k.encode(b));
+	BOOST_CHECK(k.encode_precedence(a) == k.encode_precedence(b));
+	BOOST_CHECK(k.encode(p.parse("1.0.0-rc+zzz")) < k.encode(p.parse("1.0.0-rc.1")));
+	BOOST_CHECK(k.encode(p.parse("1.0.0-rc")) < k.encode(p.parse("1.0.0-rc+a")));
+}
+
+// decoding restores encoded data
+BOOST_AUTO_TEST_CASE(key_roundtrip) {
+	for (const auto& s : { "0.0.0", "1.2.3-alpha.1+build.314", "1.2.3+b.1.x-y", "10.20.30-1.a.22.bb-0.0" }) {
+		auto v = p.parse(s);
+		auto d = k.decode(k.encode(v));
+		BOOST_CHECK_EQUAL(d.major, v.major);
+		BOOST_CHECK_EQUAL(d.minor, v.minor);
+		BOOST_CHECK_EQUAL(d.patch, v.patch);
+		BOOST_CHECK_EQUAL(d.prerelease_ids, v.prerelease_ids);
+		BOOST_CHECK_EQUAL(d.build_ids, v.build_ids);
+		BOOST_CHECK_EQUAL(k.decode(k.encode_precedence(v)).build_ids, no_build_ids);
+	}
+
+	// hand-made data with 0 bytes and negative numbers survives roundtrip as well
+	Version_data v{ -1, 0, 0, { { string("a\0b", 3), A } }, { string("\0", 1) } };
+	auto d = k.decode(k.encode(v));
+	BOOST_CHECK_EQUAL(d.major, -1);
+	BOOST_CHECK_EQUAL(d.prerelease_ids, v.prerelease_ids);
+	BOOST_CHECK_EQUAL(d.build_ids, v.build_ids);
+	BOOST_CHECK(k.encode(v) < k.encode(p.parse("0.0.0")));
+}
+
+// keys can be appended to a prefix
+BOOST_AUTO_TEST_CASE(key_append) {
+	string key = "pkg/";
+	k.append(p.parse("1.2.3"), key);
+	BOOST_CHECK_EQUAL(key.substr(4), k.encode(p.parse("1.2.3")));
+}
+
+// malformed keys are rejected
+BOOST_AUTO_TEST_CASE(key_malformed) {
+	BOOST_CHECK_THROW(k.decode(""), Parse_error);
+	BOOST_CHECK_THROW(k.decode(string(12, '\x80')), Parse_error);
+	BOOST_CHECK_THROW(k.decode(string(12, '\x80') + "\x07"), Parse_error);
+	BOOST_CHECK_THROW(k.decode(string(12, '\x80') + "\x01\x05" + "12"), Parse_error);
+	BOOST_CHECK_THROW(k.decode(string(12, '\x80') + "\x02" + "ab"), Parse_error);
+}
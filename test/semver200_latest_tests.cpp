@@ -0,0 +1,134 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_latest_tests
+
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_latest.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	string text(const shared_ptr<const Semver200_version>& v) {
+		ostringstream os;
+		os << *v;
+		return os.str();
+	}
+
+	/// Deterministic version for writer t and step i; every fourth one is a prerelease.
+	Semver200_version make_version(const unsigned t, const int i) {
+		const size_t h = (static_cast<size_t>(t) * 1000003u + static_cast<size_t>(i)) * 2654435761u;
+		string s = to_string(h % 5) + "." + to_string(h / 5 % 7) + "." + to_string(h / 35 % 11);
+		if (h % 4 == 0) s += "-rc." + to_string(h / 3 % 5);
+		return Semver200_version(s);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(latest_single_thread) {
+	Semver200_latest_version l;
+	BOOST_CHECK(l.latest() == nullptr);
+	BOOST_CHECK(l.latest_stable() == nullptr);
+	BOOST_CHECK(l.publish(Semver200_version("1.0.0-rc.1")));
+	BOOST_CHECK_EQUAL(text(l.latest()), "1.0.0-rc.1");
+	BOOST_CHECK(l.latest_stable() == nullptr);
+	BOOST_CHECK(l.publish(Semver200_version("0.9.0")));
+	BOOST_CHECK_EQUAL(text(l.latest()), "1.0.0-rc.1");
+	BOOST_CHECK_EQUAL(text(l.latest_stable()), "0.9.0");
+	const auto old = l.latest();
+	BOOST_CHECK(l.publish(Semver200_version("1.0.0+b1")));
+	BOOST_CHECK(!l.publish(Semver200_version("1.0.0+b2")));
+	BOOST_CHECK(!l.publish(Semver200_version("0.1.0")));
+	BOOST_CHECK_EQUAL(text(l.latest()), "1.0.0+b1");
+	BOOST_CHECK_EQUAL(text(l.latest_stable()), "1.0.0+b1");
+	// superseded versions stay readable while held
+	BOOST_CHECK_EQUAL(text(old), "1.0.0-rc.1");
+}
+
+// superseded versions are freed once nobody holds them, instead of living as long as the tracker
+BOOST_AUTO_TEST_CASE(latest_reclaim) {
+	Semver200_latest_tracker tracker;
+	tracker.publish("a", Semver200_version("1.0.0"));
+	const weak_ptr<const Semver200_version> first = tracker.latest("a");
+	const auto held = tracker.latest("a");
+	tracker.publish("a", Semver200_version("1.1.0"));
+	const weak_ptr<const Semver200_version> second = tracker.latest("a");
+	for (int i = 2; i < 100; ++i) tracker.publish("a", Semver200_version("1." + to_string(i) + ".0"));
+	BOOST_CHECK(second.expired());
+	BOOST_CHECK(!first.expired());
+	BOOST_CHECK_EQUAL(text(held), "1.0.0");
+	BOOST_CHECK_EQUAL(text(tracker.latest("a")), "1.99.0");
+}
+
+// concurrent writers end with the same maxima as a sequential scan; readers only see maxima increase
+BOOST_AUTO_TEST_CASE(latest_concurrent) {
+	const unsigned writers = 4;
+	const int steps = 2000;
+	const vector<string> keys = { "a", "b", "c", "d", "e" };
+	Semver200_latest_tracker tracker(2);
+	atomic<bool> done{ false };
+	atomic<int> regressions{ 0 };
+
+	thread reader([&]() {
+		shared_ptr<const Semver200_version> last;
+		while (!done.load()) {
+			const auto v = tracker.latest("a");
+			if (last && v && *v < *last) ++regressions;
+			if (v) last = v;
+		}
+	});
+	vector<thread> pool;
+	for (unsigned t = 0; t < writers; ++t) {
+		pool.emplace_back([&, t]() {
+			for (int i = 0; i < steps; ++i) tracker.publish(keys[static_cast<size_t>(i) % keys.size()], make_version(t, i));
+		});
+	}
+	for (auto& th : pool) th.join();
+	done = true;
+	reader.join();
+	BOOST_CHECK_EQUAL(regressions.load(), 0);
+
+	for (size_t k = 0; k < keys.size(); ++k) {
+		const Semver200_version* max = nullptr;
+		const Semver200_version* stable = nullptr;
+		vector<Semver200_version> all;
+		for (unsigned t = 0; t < writers; ++t) {
+			for (int i = static_cast<int>(k); i < steps; i += static_cast<int>(keys.size())) all.push_back(make_version(t, i));
+		}
+		for (const auto& v : all) {
+			if (!max || v > *max) max = &v;
+			if (v.prerelease().empty() && (!stable || v > *stable)) stable = &v;
+		}
+		BOOST_REQUIRE(tracker.latest(keys[k]) && tracker.latest_stable(keys[k]));
+		BOOST_CHECK(*tracker.latest(keys[k]) == *max);
+		BOOST_CHECK(*tracker.latest_stable(keys[k]) == *stable);
+	}
+	BOOST_CHECK(tracker.latest("missing") == nullptr);
+}
@@ -0,0 +1,94 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_lazy_tests
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_lazy_version.h"
+
+using namespace version;
+using namespace std;
+
+using lv = Semver200_lazy_version;
+
+// parsing a string into a lazy version is never an implicit conversion
+static_assert(!is_convertible<string, lv>::value, "string must not convert to lazy version implicitly");
+
+// parts are decoded like by the eager parser
+BOOST_AUTO_TEST_CASE(lazy_parts) {
+	for (const string s : { "0.0.0", "1.2.3", "1.2.3-rc.1", "1.2.3+b.5", "10.20.30-alpha.beta+exp.sha.5114f85" }) {
+		const lv l(s);
+		const Semver200_version e(s);
+		BOOST_CHECK_EQUAL(l.major(), e.major());
+		BOOST_CHECK_EQUAL(l.minor(), e.minor());
+		BOOST_CHECK_EQUAL(l.patch(), e.patch());
+		BOOST_CHECK_EQUAL(l.prerelease(), e.prerelease());
+		BOOST_CHECK_EQUAL(l.build(), e.build());
+		BOOST_CHECK_EQUAL(l.data().prerelease_ids, e.data().prerelease_ids);
+		BOOST_CHECK_EQUAL(l.data().build_ids, e.data().build_ids);
+		BOOST_CHECK(l.version() == e);
+
+		stringstream ss;
+		ss << l;
+		BOOST_CHECK_EQUAL(ss.str(), s);
+	}
+	BOOST_CHECK_EQUAL(lv().str(), "0.0.0");
+	BOOST_CHECK_EQUAL(lv("1.2.3-x+y", 5).str(), "1.2.3");
+}
+
+// copies and moves keep parts pointing into their own text
+BOOST_AUTO_TEST_CASE(lazy_copy) {
+	lv a("1.2.3-rc.1+b");
+	lv b = a;
+	lv c = std::move(a);
+	a = lv("9.9.9");
+	BOOST_CHECK_EQUAL(b.prerelease(), "rc.1");
+	BOOST_CHECK_EQUAL(c.build(), "b");
+	BOOST_CHECK(c.prerelease_text().data >= c.str().data());
+	BOOST_CHECK_EQUAL(a.major(), 9);
+}
+
+// comparison agrees with eager versions
+BOOST_AUTO_TEST_CASE(lazy_compare) {
+	const vector<string> src = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta", "1.0.0-beta.2",
+		"1.0.0-beta.11", "1.0.0-rc.1", "1.0.0", "1.0.0+b", "1.0.1", "1.1.0", "2.0.0-0" };
+	for (const auto& l : src) {
+		for (const auto& r : src) {
+			BOOST_CHECK_EQUAL(lv(l) < lv(r), Semver200_version(l) < Semver200_version(r));
+			BOOST_CHECK_EQUAL(lv(l) == lv(r), Semver200_version(l) == Semver200_version(r));
+			BOOST_CHECK_EQUAL(lv(l) >= lv(r), Semver200_version(l) >= Semver200_version(r));
+		}
+	}
+}
+
+// invalid text is rejected up front
+BOOST_AUTO_TEST_CASE(lazy_invalid) {
+	for (const string s : { "1.2", "01.2.3", "1.2.3-", "1.2.3-a..b", "1.2.3+b#1" }) {
+		BOOST_CHECK_THROW(lv{ s }, Parse_error);
+	}
+}
@@ -0,0 +1,84 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_literal_tests
+
+#include <string>
+#include "semver200_parser_util.h"
+#include "semver200_literal.h"
+
+using namespace version;
+using namespace version::literals;
+using namespace std;
+
+constexpr auto min_protocol = "1.4.0"_semver;
+constexpr auto feature_gate = "2.0.0-rc.1+exp.sha.5114f85"_semver;
+
+static_assert(min_protocol.major() == 1 && min_protocol.minor() == 4 && min_protocol.patch() == 0, "");
+static_assert(feature_gate.prerelease().size == 4 && feature_gate.build().size == 15, "");
+static_assert(min_protocol < feature_gate, "");
+static_assert("1.0.0-alpha"_semver < "1.0.0-alpha.1"_semver, "");
+static_assert("1.0.0-alpha.1"_semver < "1.0.0-alpha.beta"_semver, "");
+static_assert("1.0.0-beta.2"_semver < "1.0.0-beta.11"_semver, "");
+static_assert("1.0.0-rc.1"_semver < "1.0.0"_semver, "");
+static_assert("1.0.0+a"_semver == "1.0.0+b"_semver, "");
+static_assert("2.0.0"_semver > "1.99.99"_semver, "");
+static_assert("1.0.0-x.7.z.92"_semver >= "1.0.0-x.7.z.92"_semver, "");
+static_assert("1.0.0-beta"_semver != "1.0.0-Beta"_semver, "");
+
+// literals carry the same parts as parsed versions
+BOOST_AUTO_TEST_CASE(literal_parts) {
+	const auto v = feature_gate.version();
+	BOOST_CHECK_EQUAL(v.prerelease(), "rc.1");
+	BOOST_CHECK_EQUAL(v.build(), "exp.sha.5114f85");
+	BOOST_CHECK_EQUAL(feature_gate.str().str(), "2.0.0-rc.1+exp.sha.5114f85");
+	BOOST_CHECK_EQUAL(feature_gate.view().prerelease.str(), "rc.1");
+}
+
+// literals compare with runtime versions
+BOOST_AUTO_TEST_CASE(literal_runtime_compare) {
+	const string src[] = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta", "1.0.0-beta.2",
+		"1.0.0-beta.11", "1.0.0-rc.1", "1.0.0", "1.0.0+b", "1.4.0", "2.0.0-rc.1" };
+	for (const auto& l : src) {
+		const Semver200_literal lit(l.data(), l.size());
+		for (const auto& r : src) {
+			const Semver200_version v(r);
+			const Semver200_version lv(l);
+			BOOST_CHECK_EQUAL(lit < v, lv < v);
+			BOOST_CHECK_EQUAL(lit == v, lv == v);
+			BOOST_CHECK_EQUAL(v < lit, v < lv);
+			BOOST_CHECK_EQUAL(lit >= v, lv >= v);
+			BOOST_CHECK_EQUAL(compare(lit, Semver200_literal(r.data(), r.size())) < 0, lv < v);
+		}
+	}
+	BOOST_CHECK(Semver200_version("1.5.0") >= min_protocol);
+	BOOST_CHECK(Semver200_version("1.3.9") < min_protocol);
+}
+
+// invalid versions are rejected by the same rules as the parser at run time
+BOOST_AUTO_TEST_CASE(literal_invalid) {
+	for (const string s : { "01.2.3", "1.2", "1.2.3-", "1.2.3-01", "1.2.3+b#1", "2147483648.0.0" }) {
+		BOOST_CHECK_THROW(Semver200_literal(s.data(), s.size()), Parse_error);
+	}
+}
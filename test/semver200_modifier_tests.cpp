@@ -223,7 +223,7 @@ BOOST_AUTO_TEST_CASE(inc_major) {
 	BOOST_CHECK(v2.build() == "");
 
 	// Check non-default increment
-	auto v2 = v.inc_major(3);
+	v2 = v.inc_major(3);
 	BOOST_CHECK(v2.major() == 4);
 	BOOST_CHECK(v2.minor() == 0);
 	BOOST_CHECK(v2.patch() == 0);
@@ -257,7 +257,7 @@ BOOST_AUTO_TEST_CASE(inc_minor) {
 	BOOST_CHECK(v2.build() == "");
 
 	// Check non-default increment
-	auto v2 = v.inc_minor(3);
+	v2 = v.inc_minor(3);
 	BOOST_CHECK(v2.major() == 1);
 	BOOST_CHECK(v2.minor() == 5);
 	BOOST_CHECK(v2.patch() == 0);
@@ -291,7 +291,7 @@ BOOST_AUTO_TEST_CASE(inc_patch) {
 	BOOST_CHECK(v2.build() == "");
 
 	// Check default increment
-	auto v2 = v.inc_patch(3);
+	v2 = v.inc_patch(3);
 	BOOST_CHECK(v2.major() == 1);
 	BOOST_CHECK(v2.minor() == 2);
 	BOOST_CHECK(v2.patch() == 6);
@@ -312,3 +312,39 @@ BOOST_AUTO_TEST_CASE(inc_patch) {
 	// Check source version is unaffected
 	CHECK_SRC
 }
+
+BOOST_AUTO_TEST_CASE(rvalue_chain) {
+	const Semver200_version v("1.2.3-pre.rel.0+build.no.321");
+
+	// Chained modifications of temporaries give the same results as modifications of copies
+	auto v2 = Semver200_version("1.2.3-pre.rel.0+build.no.321").set_major(4).set_minor(5).set_patch(6)
+		.set_prerelease("rc.1").set_build("b.7");
+	BOOST_CHECK(v2.major() == 4);
+	BOOST_CHECK(v2.minor() == 5);
+	BOOST_CHECK(v2.patch() == 6);
+	BOOST_CHECK(v2.prerelease() == "rc.1");
+	BOOST_CHECK(v2.build() == "b.7");
+
+	auto v3 = Semver200_version(v).inc_minor().reset_prerelease("beta").reset_build("x");
+	BOOST_CHECK(v3.minor() == 3);
+	BOOST_CHECK(v3.patch() == 0);
+	BOOST_CHECK(v3.prerelease() == "beta");
+	BOOST_CHECK(v3.build() == "x");
+	BOOST_CHECK(Semver200_version(v).inc_major(2).major() == 3);
+	BOOST_CHECK(Semver200_version(v).inc_patch().patch() == 4);
+	BOOST_CHECK(Semver200_version(v).reset_minor(9).prerelease() == "");
+
+	// Invalid values are still rejected
+	BOOST_CHECK_THROW(Semver200_version(v).set_patch(-1), version::Modification_error);
+
+	// Moved identifiers end up in the result
+	Semver200_version w("1.2.3-pre.rel.0+build.no.321");
+	auto w2 = std::move(w).set_major(7);
+	BOOST_CHECK(w2.prerelease() == "pre.rel.0");
+	BOOST_CHECK(w2.build() == "build.no.321");
+
+	// Modifier overloads for rvalue data reuse it
+	auto d = m.set_build(p.parse("1.2.3-x+y"), Build_identifiers{ "z" });
+	BOOST_CHECK(d.prerelease_ids.size() == 1);
+	BOOST_CHECK(d.build_ids == Build_identifiers{ "z" });
+}
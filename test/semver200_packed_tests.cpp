@@ -0,0 +1,127 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_packed_tests
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "semver200_parser_util.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	Packed_version packed(const string& s) {
+		return p.parse_packed(s.data(), s.size());
+	}
+
+	const string long_version = "1.2.3-alpha.beta.gamma.delta.1+build.sha.5114f85";
+	const Semver200_comparator c;
+}
+
+static_assert(sizeof(Packed_version) <= 48, "packed version should fit into 48 bytes");
+
+// parsed parts match Version_data produced by the parser
+BOOST_AUTO_TEST_CASE(packed_parse) {
+	for (const string& s : vector<string>{ "0.0.0", "1.2.3-rc.1", "1.2.3+b.5", "10.20.30-alpha.0.x+exp", long_version }) {
+		const Packed_version v = packed(s);
+		const Version_data d = p.parse(s);
+		BOOST_CHECK_EQUAL(v.major(), d.major);
+		BOOST_CHECK_EQUAL(v.minor(), d.minor);
+		BOOST_CHECK_EQUAL(v.patch(), d.patch);
+		BOOST_CHECK_EQUAL(v.to_data().prerelease_ids, d.prerelease_ids);
+		BOOST_CHECK_EQUAL(v.to_data().build_ids, d.build_ids);
+		BOOST_CHECK_EQUAL(Packed_version(d).to_data().prerelease_ids, d.prerelease_ids);
+		BOOST_CHECK_EQUAL(Packed_version(d).build().str(), v.build().str());
+	}
+	BOOST_CHECK(packed("1.2.3-rc.1").is_inline());
+	BOOST_CHECK(!packed(long_version).is_inline());
+	BOOST_CHECK_EQUAL(packed(long_version).prerelease().str(), "alpha.beta.gamma.delta.1");
+
+	Packed_version v = packed("1.0.0");
+	BOOST_CHECK(!p.try_parse("1.0", 3, v));
+	BOOST_CHECK_EQUAL(v.major(), 1);
+	BOOST_CHECK(p.try_parse("2.0.0-x", 7, v));
+	BOOST_CHECK_EQUAL(v.prerelease().str(), "x");
+	BOOST_CHECK_THROW(packed("1.2.3-01"), Parse_error);
+}
+
+// copies and moves work between inline and heap storage
+BOOST_AUTO_TEST_CASE(packed_copy_move) {
+	const vector<string> src = { "1.2.3-rc.1", long_version, "4.5.6" };
+	for (const auto& a : src) {
+		for (const auto& b : src) {
+			Packed_version x = packed(a);
+			Packed_version y = packed(b);
+			Packed_version c(x);
+			y = c;
+			BOOST_CHECK_EQUAL(y.prerelease().str(), x.prerelease().str());
+			Packed_version m(move(c));
+			BOOST_CHECK_EQUAL(m.build().str(), x.build().str());
+			y = packed(b);
+			y = move(m);
+			BOOST_CHECK_EQUAL(y.build().str(), x.build().str());
+			const Packed_version& self = y;
+			y = self;
+			BOOST_CHECK_EQUAL(y.prerelease().str(), x.prerelease().str());
+		}
+	}
+}
+
+// comparison agrees with Version_data
+BOOST_AUTO_TEST_CASE(packed_compare) {
+	const vector<string> src = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta.11", "1.0.0-rc.1",
+		"1.0.0", "1.0.0+b", "2.0.0", long_version };
+	for (const auto& l : src) {
+		for (const auto& r : src) {
+			BOOST_CHECK_EQUAL(c.compare(packed(l), packed(r)), c.compare(p.parse(l), p.parse(r)));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(packed_modify) {
+	const Semver200_modifier m;
+	const Packed_version v = packed("1.2.3-rc.1+b");
+	BOOST_CHECK_EQUAL(m.set_major(v, 7).major(), 7);
+	BOOST_CHECK_EQUAL(m.set_major(v, 7).build().str(), "b");
+	BOOST_CHECK_EQUAL(m.set_minor(v, 7).minor(), 7);
+	BOOST_CHECK_EQUAL(m.set_patch(v, 7).patch(), 7);
+	BOOST_CHECK_EQUAL(m.set_prerelease(v, "alpha.0").prerelease().str(), "alpha.0");
+	BOOST_CHECK_EQUAL(m.set_prerelease(v, "alpha.0").build().str(), "b");
+	BOOST_CHECK_EQUAL(m.set_build(v, "").build().str(), "");
+	BOOST_CHECK_EQUAL(m.set_build(v, "sha.0abc").prerelease().str(), "rc.1");
+	BOOST_CHECK(m.reset_major(v, 2).view().prerelease.empty());
+	BOOST_CHECK_EQUAL(m.reset_minor(v, 2).patch(), 0);
+	BOOST_CHECK(m.reset_patch(v, 2).build().empty());
+	BOOST_CHECK(m.reset_prerelease(v, "x").build().empty());
+	BOOST_CHECK_EQUAL(m.reset_build(v, "y").prerelease().str(), "rc.1");
+
+	BOOST_CHECK_THROW(m.set_major(v, -1), Modification_error);
+	for (const char* bad : { "a..b", ".a", "a.", "a+b", "01" }) {
+		BOOST_CHECK_THROW(m.set_prerelease(v, bad), Modification_error);
+	}
+	BOOST_CHECK_NO_THROW(m.set_build(v, "01"));
+	BOOST_CHECK_THROW(m.set_build(v, "a_b"), Modification_error);
+}
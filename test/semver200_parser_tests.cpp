@@ -25,6 +25,7 @@ SOFTWARE.
 #define BOOST_TEST_MODULE semver200_parser_tests
 
 #include "semver200_parser_util.h"
+#include "semver200_dfa.h"
 
 using namespace version;
 using namespace std;
@@ -134,3 +135,101 @@ BOOST_AUTO_TEST_CASE(parse_corner_cases) {
 		Build_identifiers({ "build","314" }));
 
 }
+
+// normal versions must fit into int and must not be empty
+BOOST_AUTO_TEST_CASE(parse_normal_range) {
+	CHECK_NORMALS("2147483647.0.0", 2147483647, 0, 0);
+	CHECK_PARSE_ERROR("2147483648.0.0");
+	CHECK_PARSE_ERROR("1.99999999999999999999.0");
+	CHECK_PARSE_ERROR("");
+	CHECK_PARSE_ERROR(".1.2");
+	CHECK_PARSE_ERROR("1..2");
+	CHECK_PARSE_ERROR("1.2.");
+	CHECK_PARSE_ERROR("1.2.-a");
+	CHECK_PARSE_ERROR("1.2.3.4");
+	CHECK_PARSE_ERROR(std::string("1.2.3\0", 6));
+}
+
+#define CHECK_TRY_PARSE(VER, CODE, OFFSET, CHAR) { \
+	Version_data v{ 9, 9, 9, no_rel_ids, no_build_ids }; \
+	auto st = p.try_parse(VER, v); \
+	BOOST_CHECK(st.code == CODE); \
+	BOOST_CHECK_EQUAL(st.offset, OFFSET); \
+	BOOST_CHECK_EQUAL(st.character, CHAR); \
+	BOOST_CHECK_EQUAL(v.major, 9); \
+}
+
+// non-throwing parse reports error code, offset and offending character
+BOOST_AUTO_TEST_CASE(try_parse_errors) {
+	CHECK_TRY_PARSE("1.2.x", Parse_errc::invalid_character, 4u, 'x');
+	CHECK_TRY_PARSE("01.0.0", Parse_errc::leading_zero, 1u, '1');
+	CHECK_TRY_PARSE("1.2.3-a.01", Parse_errc::numeric_leading_zero, 8u, '0');
+	CHECK_TRY_PARSE("1.2.3-a..b", Parse_errc::empty_identifier, 8u, '.');
+	CHECK_TRY_PARSE("1.2.3+", Parse_errc::empty_identifier, 6u, '\0');
+	CHECK_TRY_PARSE("1..2", Parse_errc::empty_number, 2u, '.');
+	CHECK_TRY_PARSE("1.2", Parse_errc::unexpected_end, 3u, '\0');
+	CHECK_TRY_PARSE("1.3000000000.0", Parse_errc::out_of_range, 2u, '3');
+	CHECK_TRY_PARSE("1.2.3+b+c", Parse_errc::invalid_character, 7u, '+');
+
+	try {
+		p.parse("1.2.x");
+		BOOST_ERROR("Parse_error expected");
+	} catch (Parse_error& e) {
+		BOOST_CHECK_EQUAL(e.what(), std::string("invalid character encountered: x"));
+	}
+}
+
+// non-throwing parse stores result on success
+BOOST_AUTO_TEST_CASE(try_parse_success) {
+	Version_data v{ 0, 0, 0, no_rel_ids, no_build_ids };
+	auto st = p.try_parse("1.2.3-rc.1+b", v);
+	BOOST_CHECK(static_cast<bool>(st));
+	BOOST_CHECK_EQUAL(st.offset, 12u);
+	BOOST_CHECK_EQUAL(v.major, 1);
+	BOOST_CHECK_EQUAL(v.prerelease_ids, Prerelease_identifiers({ { "rc", A },{ "1", N } }));
+	BOOST_CHECK_EQUAL(v.build_ids, Build_identifiers({ "b" }));
+
+	const std::string s = "2.0.0-x";
+	Version_view vv{ 0, 0, 0, String_ref(), String_ref() };
+	BOOST_CHECK(static_cast<bool>(p.try_parse(s.data(), s.size(), vv)));
+	BOOST_CHECK_EQUAL(vv.major, 2);
+	BOOST_CHECK_EQUAL(vv.prerelease.str(), "x");
+}
+
+// vectorized identifier validation agrees with scalar one for every length and position of invalid byte
+BOOST_AUTO_TEST_CASE(simd_identifier_skip) {
+	const std::string valid = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz-"
+		"0123456789abcdefghijklmnopqrstuvwxyz";
+	const char invalid[] = { '.', '+', '/', ':', '@', '[', '`', '{', '\0', '\x80', '\xff', ' ', '_' };
+	for (auto level : { dfa::Simd_level::scalar, dfa::Simd_level::sse2, dfa::Simd_level::avx2 }) {
+		for (size_t len = 0; len <= valid.size(); ++len) {
+			const std::string s = valid.substr(0, len);
+			BOOST_CHECK(dfa::skip_identifier_chars(s.data(), s.data() + len, level) == s.data() + len);
+			for (size_t pos = 0; pos < len; ++pos) {
+				for (const char c : invalid) {
+					std::string t = s;
+					t[pos] = c;
+					BOOST_CHECK(dfa::skip_identifier_chars(t.data(), t.data() + len, level) == t.data() + pos);
+				}
+			}
+		}
+	}
+}
+
+// long identifiers are validated correctly
+BOOST_AUTO_TEST_CASE(parse_long_identifiers) {
+	const std::string sha = "5114f85e9c1d2f0b8a7e6d5c4b3a29180f7e6d5c";
+	CHECK_PREREL_BUILD("1.2.3-alpha-" + sha + "+git." + sha + sha, 1, 2, 3,
+		Prerelease_identifiers({ { "alpha-" + sha, A } }), Build_identifiers({ "git", sha + sha }));
+	for (size_t pos = 0; pos < sha.size(); ++pos) {
+		std::string bad = sha;
+		bad[pos] = '_';
+		Version_data v{ 0, 0, 0, no_rel_ids, no_build_ids };
+		auto st = p.try_parse("1.2.3+" + bad + sha, v);
+		BOOST_CHECK(st.code == Parse_errc::invalid_character);
+		BOOST_CHECK_EQUAL(st.offset, 6 + pos);
+		st = p.try_parse("1.2.3-x" + bad + sha, v);
+		BOOST_CHECK(st.code == Parse_errc::invalid_character);
+		BOOST_CHECK_EQUAL(st.offset, 7 + pos);
+	}
+}
@@ -0,0 +1,147 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_range_index_tests
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_range_index.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	vector<Semver200_range_index::Id> sorted(vector<Semver200_range_index::Id> ids) {
+		sort(ids.begin(), ids.end());
+		return ids;
+	}
+
+	using Ids = vector<Semver200_range_index::Id>;
+}
+
+// stabbing queries return every range containing the version
+BOOST_AUTO_TEST_CASE(range_index_find) {
+	Semver200_range_index idx;
+	vector<pair<size_t, Semver200_range>> ranges = {
+		{ 1, Semver200_range{ "^1.2.0" } },
+		{ 2, Semver200_range{ "~1.2.3" } },
+		{ 3, Semver200_range{ ">=2.0.0" } },
+		{ 4, Semver200_range{ "<1.0.0 || 1.5.x || 1.5.1" } },
+		{ 5, Semver200_range{ "*" } },
+		{ 6, Semver200_range{ ">*" } }
+	};
+	idx.insert(ranges.begin(), ranges.end());
+	BOOST_CHECK_EQUAL(idx.size(), 7u);
+
+	BOOST_CHECK(sorted(idx.find(p.parse("1.2.5"))) == (Ids{ 1, 2, 5 }));
+	BOOST_CHECK(sorted(idx.find(p.parse("1.5.1"))) == (Ids{ 1, 4, 5 }));
+	BOOST_CHECK(sorted(idx.find(p.parse("0.9.0"))) == (Ids{ 4, 5 }));
+	BOOST_CHECK(sorted(idx.find(p.parse("3.0.0"))) == (Ids{ 3, 5 }));
+	BOOST_CHECK(idx.find(p.parse("3.0.0-rc.1")).empty());
+}
+
+// prerelease admission follows Semver200_range
+BOOST_AUTO_TEST_CASE(range_index_prerelease) {
+	Semver200_range_index idx;
+	idx.insert(1, Semver200_range{ ">=1.2.3-beta <2.0.0" });
+	idx.insert(2, Semver200_range{ "^1.0.0", true });
+	idx.insert(3, Semver200_range{ "^1.0.0" });
+	BOOST_CHECK(sorted(idx.find(p.parse("1.2.3-rc"))) == (Ids{ 1, 2 }));
+	BOOST_CHECK(sorted(idx.find(p.parse("1.4.0-rc"))) == (Ids{ 2 }));
+	BOOST_CHECK(sorted(idx.find(p.parse("1.4.0+build"))) == (Ids{ 1, 2, 3 }));
+}
+
+// batch removal drops all intervals of removed ranges
+BOOST_AUTO_TEST_CASE(range_index_erase) {
+	Semver200_range_index idx;
+	idx.insert(1, Semver200_range{ "1.x || 3.x" });
+	idx.insert(2, Semver200_range{ "^1.1.0" });
+	idx.insert(3, Semver200_range{ "<4.0.0" });
+	const Ids gone = { 1, 3 };
+	idx.erase(gone.begin(), gone.end());
+	BOOST_CHECK_EQUAL(idx.size(), 1u);
+	BOOST_CHECK(idx.find(p.parse("1.2.0")) == (Ids{ 2 }));
+	BOOST_CHECK(idx.find(p.parse("3.0.0")).empty());
+	idx.erase(2);
+	BOOST_CHECK(idx.empty());
+	BOOST_CHECK(idx.find(p.parse("1.2.0")).empty());
+}
+
+// identifier inserted several times is reported once
+BOOST_AUTO_TEST_CASE(range_index_repeated_id) {
+	Semver200_range_index idx;
+	idx.insert(1, Semver200_range{ ">=1.0.0" });
+	idx.insert(1, Semver200_range{ ">=2.0.0" });
+	idx.insert(2, Semver200_range{ ">=1.5.0" });
+	BOOST_CHECK(sorted(idx.find(p.parse("3.0.0"))) == (Ids{ 1, 2 }));
+	BOOST_CHECK(idx.find(p.parse("1.2.0")) == (Ids{ 1 }));
+	idx.erase(1);
+	BOOST_CHECK(idx.find(p.parse("3.0.0")) == (Ids{ 2 }));
+}
+
+// once multi-interval ranges are gone, results come in the same order as from a fresh index
+BOOST_AUTO_TEST_CASE(range_index_erase_multi_interval) {
+	Semver200_range_index idx, fresh;
+	idx.insert(1, Semver200_range{ "1.x || 3.x" });
+	for (auto* i : { &idx, &fresh }) {
+		i->insert(7, Semver200_range{ ">=1.0.0" });
+		i->insert(4, Semver200_range{ ">=2.0.0" });
+	}
+	idx.erase(1);
+	BOOST_CHECK(idx.find(p.parse("3.0.0")) == fresh.find(p.parse("3.0.0")));
+	BOOST_CHECK(fresh.find(p.parse("3.0.0")) == (Ids{ 7, 4 }));
+}
+
+// index agrees with linear scan over satisfies()
+BOOST_AUTO_TEST_CASE(range_index_matches_scan) {
+	const vector<string> ops = { "^", "~", ">=", "<", ">", "<=", "=" };
+	vector<pair<size_t, Semver200_range>> ranges;
+	for (size_t i = 0; i < 500; ++i) {
+		string r = ops[i % ops.size()] + to_string(i % 4) + "." + to_string(i % 3) + "." + to_string(i % 5);
+		if (i % 11 == 0) r += "-rc." + to_string(i % 3);
+		if (i % 7 == 0) r += " || " + ops[(i / 7) % ops.size()] + to_string(i % 5) + ".x";
+		ranges.emplace_back(i, Semver200_range{ r });
+	}
+	Semver200_range_index idx;
+	idx.insert(ranges.begin(), ranges.begin() + 250);
+	idx.insert(ranges.begin() + 250, ranges.end());
+
+	for (int M = 0; M < 5; ++M) {
+		for (int m = 0; m < 4; ++m) {
+			for (int pt = 0; pt < 6; ++pt) {
+				for (const string pre : { "", "-rc.0", "-rc.1", "-rc.5" }) {
+					const auto v = p.parse(to_string(M) + "." + to_string(m) + "." + to_string(pt) + pre);
+					Ids expected;
+					for (const auto& r : ranges) {
+						if (r.second.satisfies(v)) expected.push_back(r.first);
+					}
+					BOOST_CHECK(sorted(idx.find(v)) == expected);
+				}
+			}
+		}
+	}
+}
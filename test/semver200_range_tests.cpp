@@ -0,0 +1,165 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_range_tests
+
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_range.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	bool sat(const string& range, const string& v, const bool include_prerelease = false) {
+		return Semver200_range(range, include_prerelease).satisfies(p.parse(v));
+	}
+}
+
+// primitive comparators and exact match
+BOOST_AUTO_TEST_CASE(range_primitives) {
+	BOOST_CHECK(sat(">=1.2.3", "1.2.3"));
+	BOOST_CHECK(!sat(">1.2.3", "1.2.3"));
+	BOOST_CHECK(sat(">1.2.3", "1.2.4"));
+	BOOST_CHECK(sat("<=1.2.3", "1.2.3"));
+	BOOST_CHECK(!sat("<1.2.3", "1.2.3"));
+	BOOST_CHECK(sat("1.2.3", "1.2.3"));
+	BOOST_CHECK(sat("=1.2.3", "1.2.3+build"));
+	BOOST_CHECK(!sat("1.2.3", "1.2.4"));
+	BOOST_CHECK(sat("v1.2.3", "1.2.3"));
+	BOOST_CHECK(sat(">= 1.0.0 < 2.0.0", "1.5.0"));
+	BOOST_CHECK(sat(">=1.0.0, <2.0.0", "1.5.0"));
+	BOOST_CHECK(!sat(">=1.0.0, <2.0.0", "2.0.0"));
+	BOOST_CHECK(!sat(">2.0.0 <1.0.0", "1.5.0"));
+}
+
+// caret ranges keep left-most non-zero component
+BOOST_AUTO_TEST_CASE(range_caret) {
+	BOOST_CHECK(sat("^1.2.3", "1.2.3"));
+	BOOST_CHECK(sat("^1.2.3", "1.9.0"));
+	BOOST_CHECK(!sat("^1.2.3", "2.0.0"));
+	BOOST_CHECK(!sat("^1.2.3", "1.2.2"));
+	BOOST_CHECK(sat("^0.2.3", "0.2.9"));
+	BOOST_CHECK(!sat("^0.2.3", "0.3.0"));
+	BOOST_CHECK(sat("^0.0.3", "0.0.3"));
+	BOOST_CHECK(!sat("^0.0.3", "0.0.4"));
+	BOOST_CHECK(sat("^0.0", "0.0.9"));
+	BOOST_CHECK(!sat("^0.0", "0.1.0"));
+	BOOST_CHECK(sat("^1.x", "1.9.9"));
+	BOOST_CHECK(sat("^0", "0.9.9"));
+	BOOST_CHECK(!sat("^0", "1.0.0"));
+}
+
+// tilde ranges allow patch-level changes
+BOOST_AUTO_TEST_CASE(range_tilde) {
+	BOOST_CHECK(sat("~1.2.3", "1.2.9"));
+	BOOST_CHECK(!sat("~1.2.3", "1.3.0"));
+	BOOST_CHECK(sat("~>1.2.3", "1.2.4"));
+	BOOST_CHECK(sat("~1.2", "1.2.0"));
+	BOOST_CHECK(!sat("~1.2", "1.3.0"));
+	BOOST_CHECK(sat("~1", "1.9.0"));
+	BOOST_CHECK(!sat("~1", "2.0.0"));
+}
+
+// x-ranges and partial versions
+BOOST_AUTO_TEST_CASE(range_x) {
+	BOOST_CHECK(sat("*", "3.4.5"));
+	BOOST_CHECK(sat("", "3.4.5"));
+	BOOST_CHECK(sat("1.x", "1.9.9"));
+	BOOST_CHECK(!sat("1.x", "2.0.0"));
+	BOOST_CHECK(sat("1.2.*", "1.2.7"));
+	BOOST_CHECK(!sat("1.2.X", "1.3.0"));
+	BOOST_CHECK(sat("1.2", "1.2.7"));
+	BOOST_CHECK(sat(">1.2", "1.3.0"));
+	BOOST_CHECK(!sat(">1.2", "1.2.9"));
+	BOOST_CHECK(!sat("<1.x", "1.0.0"));
+	BOOST_CHECK(sat("<1.x", "0.9.9"));
+	BOOST_CHECK(sat("<=1.2", "1.2.9"));
+	BOOST_CHECK(!sat("<=1.2", "1.3.0"));
+	BOOST_CHECK(!sat(">*", "1.0.0"));
+	BOOST_CHECK(Semver200_range(">*").intervals().empty());
+}
+
+// hyphen ranges and unions
+BOOST_AUTO_TEST_CASE(range_hyphen_union) {
+	BOOST_CHECK(sat("1.2.3 - 2.3.4", "1.2.3"));
+	BOOST_CHECK(sat("1.2.3 - 2.3.4", "2.3.4"));
+	BOOST_CHECK(!sat("1.2.3 - 2.3.4", "2.3.5"));
+	BOOST_CHECK(sat("1.2 - 2.3", "2.3.9"));
+	BOOST_CHECK(!sat("1.2 - 2.3", "2.4.0"));
+	BOOST_CHECK(sat("1.2 - 2", "1.2.0"));
+	BOOST_CHECK(sat("^1.0.0 || ^3.0.0", "3.1.0"));
+	BOOST_CHECK(!sat("^1.0.0 || ^3.0.0", "2.1.0"));
+	BOOST_CHECK(sat("1.0.0||2.0.0", "2.0.0"));
+	BOOST_CHECK_EQUAL(Semver200_range("^1.0.0 || >3.0.0 <2.0.0").intervals().size(), 1u);
+}
+
+// prereleases match only alongside a bound with prerelease of the same version
+BOOST_AUTO_TEST_CASE(range_prerelease) {
+	BOOST_CHECK(!sat("^1.2.3", "1.3.0-beta"));
+	BOOST_CHECK(sat("^1.2.3-beta", "1.2.3-rc"));
+	BOOST_CHECK(!sat("^1.2.3-beta", "1.2.3-alpha"));
+	BOOST_CHECK(!sat("^1.2.3-beta", "1.2.4-rc"));
+	BOOST_CHECK(sat("^1.2.3-beta", "1.2.4"));
+	BOOST_CHECK(sat(">1.2.3-alpha.3", "1.2.3-alpha.7"));
+	BOOST_CHECK(!sat(">1.2.3-alpha.3", "1.2.3-alpha.3"));
+	BOOST_CHECK(sat("<=1.2.3-rc.1", "1.2.3-rc.1"));
+	BOOST_CHECK(sat(">=1.0.0 <=1.2.3-rc.1", "1.2.3-beta"));
+	BOOST_CHECK(sat(">=1.2.0 >=1.2.3-beta <2.0.0", "1.2.3-rc"));
+	BOOST_CHECK(!sat("<2.0.0", "2.0.0-rc.1"));
+	BOOST_CHECK(sat("^1.2.3", "1.3.0-beta", true));
+	BOOST_CHECK(sat("<2.0.0", "2.0.0-rc.1", true));
+	BOOST_CHECK(!sat("^1.2.3", "2.0.0-rc.1", true));
+	BOOST_CHECK(sat("*", "1.0.0-rc", true));
+	BOOST_CHECK(!sat("*", "1.0.0-rc"));
+}
+
+// bounds near int limits do not overflow
+BOOST_AUTO_TEST_CASE(range_overflow) {
+	BOOST_CHECK(sat("^2147483647.0.0", "2147483647.2147483647.2147483647"));
+	BOOST_CHECK(sat("~1.2147483647", "1.2147483647.5"));
+	BOOST_CHECK(!sat("~1.2147483647", "2.0.0"));
+	BOOST_CHECK(sat(">1.2147483647.2147483647", "2.0.0"));
+	BOOST_CHECK(sat("<=2147483647.2147483647.2147483647", "2147483647.2147483647.2147483647"));
+}
+
+// malformed expressions are rejected
+BOOST_AUTO_TEST_CASE(range_invalid) {
+	const vector<string> bad = { "1.2.3.4", ">=01.2.3", "^", "1.x.3", "!1.2.3", "=>1.2.3", "1.2.3-", "a.b.c",
+		"2147483648.0.0", ">=1..2" };
+	for (const auto& r : bad) {
+		BOOST_CHECK_THROW(Semver200_range{ r }, Parse_error);
+	}
+}
+
+// ranges accept full version objects
+BOOST_AUTO_TEST_CASE(range_version_object) {
+	Semver200_range r{ ">=1.0.0 <2.0.0" };
+	BOOST_CHECK(r.satisfies(Semver200_version("1.4.0")));
+	BOOST_CHECK(!r.satisfies(Semver200_version("2.0.0")));
+	BOOST_CHECK(!r.include_prerelease());
+	BOOST_REQUIRE_EQUAL(r.intervals().size(), 1u);
+	BOOST_CHECK(r.intervals()[0].has_lower && r.intervals()[0].has_upper);
+}
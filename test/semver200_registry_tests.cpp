@@ -0,0 +1,171 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_registry_tests
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_registry.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	vector<string> texts(const Semver200_registry::Snapshot& s) {
+		vector<string> r;
+		for (const auto& v : *s) {
+			ostringstream os;
+			os << v;
+			r.push_back(os.str());
+		}
+		return r;
+	}
+
+	Semver200_version ver(const string& s) {
+		return Semver200_version(s);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(registry_insert) {
+	Semver200_registry r(4);
+	BOOST_CHECK(r.versions("a")->empty());
+	BOOST_CHECK(r.insert("a", ver("1.2.0")));
+	BOOST_CHECK(r.insert("a", ver("1.0.0")));
+	BOOST_CHECK(r.insert("a", ver("1.2.0-rc.1")));
+	BOOST_CHECK(r.insert("a", ver("1.2.0+b1")));
+	BOOST_CHECK(!r.insert("a", ver("1.2.0")));
+	BOOST_CHECK(!r.insert("a", ver("1.2.0+b1")));
+	const auto before = r.versions("a");
+	BOOST_CHECK(texts(before) == vector<string>({ "1.0.0", "1.2.0-rc.1", "1.2.0", "1.2.0+b1" }));
+
+	const vector<Semver200_version> batch = { ver("2.0.0"), ver("0.1.0"), ver("1.0.0"), ver("2.0.0") };
+	BOOST_CHECK_EQUAL(r.insert("a", batch.begin(), batch.end()), 2);
+	BOOST_CHECK(texts(r.versions("a")) == vector<string>({ "0.1.0", "1.0.0", "1.2.0-rc.1", "1.2.0", "1.2.0+b1", "2.0.0" }));
+	// snapshots taken earlier do not change
+	BOOST_CHECK_EQUAL(before->size(), 4);
+	BOOST_CHECK(r.versions("b")->empty());
+}
+
+BOOST_AUTO_TEST_CASE(registry_max_satisfying) {
+	Semver200_registry r;
+	for (const string s : { "1.0.0", "1.2.3", "1.3.0-beta", "1.9.9", "2.0.0", "2.1.0-rc.1" }) r.insert("pkg", ver(s));
+	BOOST_CHECK_EQUAL(r.max_satisfying("pkg", Semver200_range("^1.2"))->minor(), 9);
+	BOOST_CHECK_EQUAL(r.max_satisfying("pkg", Semver200_range("~1.2.0"))->patch(), 3);
+	BOOST_CHECK_EQUAL(r.max_satisfying("pkg", Semver200_range("<1.1 || >=2.0.0 <2.1"))->major(), 2);
+	BOOST_CHECK(r.max_satisfying("pkg", Semver200_range(">2.0.0")) == nullptr);
+	BOOST_CHECK_EQUAL(r.max_satisfying("pkg", Semver200_range(">2.0.0", true))->prerelease(), "rc.1");
+	BOOST_CHECK(r.max_satisfying("other", Semver200_range("*")) == nullptr);
+}
+
+// readers always see sorted snapshots that only grow while writers insert into many packages
+BOOST_AUTO_TEST_CASE(registry_concurrent) {
+	Semver200_registry r(3);
+	const int packages = 8;
+	const int per_writer = 300;
+	atomic<bool> done{ false };
+	atomic<int> failures{ 0 };
+
+	vector<thread> readers;
+	for (int t = 0; t < 2; ++t) {
+		readers.emplace_back([&]() {
+			vector<size_t> seen(packages, 0);
+			while (!done.load()) {
+				for (int p = 0; p < packages; ++p) {
+					const auto s = r.versions("p" + to_string(p));
+					if (s->size() < seen[static_cast<size_t>(p)]) ++failures;
+					if (!is_sorted(s->begin(), s->end())) ++failures;
+					seen[static_cast<size_t>(p)] = s->size();
+				}
+			}
+		});
+	}
+	vector<thread> writers;
+	for (int t = 0; t < 3; ++t) {
+		writers.emplace_back([&, t]() {
+			for (int i = 0; i < per_writer; ++i) {
+				r.insert("p" + to_string(i % packages), ver(to_string(t) + "." + to_string(i) + ".0"));
+			}
+		});
+	}
+	for (auto& th : writers) th.join();
+	done = true;
+	for (auto& th : readers) th.join();
+
+	BOOST_CHECK_EQUAL(failures.load(), 0);
+	size_t total = 0;
+	for (int p = 0; p < packages; ++p) total += r.versions("p" + to_string(p))->size();
+	BOOST_CHECK_EQUAL(total, 3 * per_writer);
+}
+
+// shard tables grow without losing packages, also while readers look packages up
+BOOST_AUTO_TEST_CASE(registry_many_packages) {
+	Semver200_registry r(2);
+	const int packages = 5000;
+	atomic<int> added{ 0 };
+	atomic<int> failures{ 0 };
+
+	thread reader([&]() {
+		while (added.load() < packages) {
+			const int n = added.load();
+			for (int p = max(0, n - 64); p < n; ++p) {
+				const auto v = r.max_satisfying("pkg-" + to_string(p), Semver200_range("*"));
+				if (!v || v->major() != p) ++failures;
+			}
+		}
+	});
+	for (int p = 0; p < packages; ++p) {
+		BOOST_CHECK(r.insert("pkg-" + to_string(p), ver(to_string(p) + ".0.0")));
+		added.store(p + 1);
+	}
+	reader.join();
+
+	BOOST_CHECK_EQUAL(failures.load(), 0);
+	for (int p = 0; p < packages; ++p) {
+		const auto s = r.versions("pkg-" + to_string(p));
+		BOOST_REQUIRE_EQUAL(s->size(), 1);
+		BOOST_CHECK_EQUAL(s->front().major(), p);
+	}
+	BOOST_CHECK(r.versions("pkg-" + to_string(packages))->empty());
+}
+
+// snapshots and versions returned to callers outlive replacement of what they were read from
+BOOST_AUTO_TEST_CASE(registry_snapshot_lifetime) {
+	Semver200_registry r(1);
+	r.insert("a", ver("1.0.0"));
+	const auto snapshot = r.versions("a");
+	const auto best = r.max_satisfying("a", Semver200_range("*"));
+	for (int i = 1; i < 100; ++i) {
+		r.insert("a", ver("1." + to_string(i) + ".0"));
+		r.insert("b" + to_string(i), ver("1.0.0"));
+	}
+	BOOST_CHECK_EQUAL(snapshot->size(), 1);
+	BOOST_CHECK_EQUAL(best->minor(), 0);
+	BOOST_CHECK_EQUAL(r.versions("a")->size(), 100);
+	BOOST_CHECK_EQUAL(r.max_satisfying("a", Semver200_range("*"))->minor(), 99);
+}
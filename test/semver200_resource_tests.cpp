@@ -0,0 +1,122 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_resource_tests
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	/// Resource forwarding to new/delete and counting outstanding allocations.
+	struct Counting_resource : Memory_resource {
+		size_t allocations = 0;
+		size_t live = 0;
+
+	protected:
+		void* do_allocate(const size_t bytes, const size_t alignment) override {
+			++allocations;
+			++live;
+			return new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* p, const size_t bytes, const size_t alignment) override {
+			--live;
+			new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+	};
+
+	const string long_version = "1.2.3-alpha.beta-long-identifier.1+build.sha.5114f85.long-build-identifier";
+	const Semver200_comparator c;
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_buffer) {
+	alignas(16) char buf[64];
+	Counting_resource upstream;
+	{
+		Monotonic_buffer_resource r(buf, sizeof(buf), &upstream);
+		char* a = static_cast<char*>(r.allocate(3, 1));
+		void* b = r.allocate(8, 8);
+		BOOST_CHECK(a == buf);
+		BOOST_CHECK(b == buf + 8);
+		BOOST_CHECK_EQUAL(upstream.allocations, 0);
+		for (int i = 0; i < 100; ++i) {
+			void* p = r.allocate(24, 8);
+			BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(p) % 8, 0);
+			r.deallocate(p, 24, 8);
+		}
+		BOOST_CHECK_EQUAL(r.bytes_allocated(), 2411);
+		// blocks grow geometrically, so only a few are needed
+		BOOST_CHECK(upstream.allocations > 0 && upstream.allocations < 5);
+		r.release();
+		BOOST_CHECK_EQUAL(upstream.live, 0);
+		BOOST_CHECK(r.allocate(1, 1) == buf);
+		r.allocate(1000, 8);
+	}
+	BOOST_CHECK_EQUAL(upstream.live, 0);
+}
+
+// all identifier storage comes from the resource
+BOOST_AUTO_TEST_CASE(resource_parse) {
+	Counting_resource r;
+	{
+		const Resource_version_data v = p.parse(long_version.data(), long_version.size(), &r);
+		const Version_data d = p.parse(long_version);
+		BOOST_CHECK(v.resource() == &r);
+		BOOST_CHECK_EQUAL(v.major, 1);
+		BOOST_CHECK_EQUAL(v.to_data().prerelease_ids, d.prerelease_ids);
+		BOOST_CHECK_EQUAL(v.to_data().build_ids, d.build_ids);
+		BOOST_CHECK(r.allocations >= 6);
+
+		// copies use the default resource
+		const Resource_version_data copy = v;
+		BOOST_CHECK(copy.resource() == new_delete_resource());
+		BOOST_CHECK_EQUAL(c.compare(copy, v), 0);
+	}
+	BOOST_CHECK_EQUAL(r.live, 0);
+
+	Resource_version_data v(&r);
+	BOOST_CHECK(!p.try_parse("1.2.3-", 6, v));
+	BOOST_CHECK(v.prerelease_ids.empty());
+	BOOST_CHECK_THROW(p.parse("1.2", 3, &r), Parse_error);
+}
+
+// a batch parsed into one arena compares like Version_data
+BOOST_AUTO_TEST_CASE(resource_batch) {
+	const vector<string> src = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta.11", "1.0.0-rc.1",
+		"1.0.0", "1.0.0+b", "2.0.0", long_version };
+	Monotonic_buffer_resource arena;
+	vector<Resource_version_data> batch;
+	for (const auto& s : src) batch.push_back(p.parse(s.data(), s.size(), &arena));
+	BOOST_CHECK(arena.bytes_allocated() > 0);
+	for (size_t i = 0; i < src.size(); ++i) {
+		for (size_t j = 0; j < src.size(); ++j) {
+			BOOST_CHECK_EQUAL(c.compare(batch[i], batch[j]), c.compare(p.parse(src[i]), p.parse(src[j])));
+		}
+	}
+}
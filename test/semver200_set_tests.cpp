@@ -0,0 +1,98 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_set_tests
+
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "version_set.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	vector<string> strings(const Version_set& s) {
+		vector<string> out;
+		for (const auto& v : s) out.push_back(to_string(v.major()) + "." + to_string(v.minor()) + "."
+			+ to_string(v.patch()) + (v.prerelease().empty() ? "" : "-" + v.prerelease()));
+		return out;
+	}
+}
+
+// bulk build sorts by precedence and drops duplicates, keeping the first one
+BOOST_AUTO_TEST_CASE(set_bulk_build) {
+	const vector<string> src = { "2.0.0", "1.0.0-rc.1", "1.0.0", "1.0.0+b2", "1.0.0-alpha", "0.9.9", "2.0.0" };
+	Version_set s(src.begin(), src.end());
+	BOOST_CHECK(strings(s) == (vector<string>{ "0.9.9", "1.0.0-alpha", "1.0.0-rc.1", "1.0.0", "2.0.0" }));
+	BOOST_CHECK(s.find("1.0.0+other")->build().empty());
+
+	const vector<string> more = { "1.5.0", "0.1.0", "1.0.0+b3" };
+	s.insert(more.begin(), more.end());
+	BOOST_CHECK_EQUAL(s.size(), 7u);
+	BOOST_CHECK(!s.insert("1.5.0").second);
+	BOOST_CHECK(s.insert(Semver200_version("3.0.0")).second);
+	BOOST_CHECK_EQUAL(s.erase(Semver200_version("3.0.0+x")), 1u);
+	BOOST_CHECK_EQUAL(s.erase(p.parse("3.0.0")), 0u);
+}
+
+// bound and neighbour queries
+BOOST_AUTO_TEST_CASE(set_bounds) {
+	const vector<string> src = { "1.0.0", "1.2.0", "1.2.1", "2.0.0-rc.1", "2.0.0", "2.4.1", "2.4.2" };
+	const Version_set s(src.begin(), src.end());
+	BOOST_CHECK_EQUAL(s.lower_bound("1.2.0")->minor(), 2);
+	BOOST_CHECK_EQUAL(s.upper_bound("1.2.0")->patch(), 1);
+	BOOST_CHECK_EQUAL(s.lower_bound(p.parse("1.5.0"))->prerelease(), "rc.1");
+	BOOST_CHECK(s.upper_bound("2.4.2") == s.end());
+	BOOST_CHECK(s.find("1.1.0") == s.end());
+
+	BOOST_CHECK_EQUAL(s.successor(p.parse("2.4.1"))->patch(), 2);
+	BOOST_CHECK(s.successor(Semver200_version("2.4.2")) == s.end());
+	BOOST_CHECK_EQUAL(s.predecessor(p.parse("2.0.0"))->prerelease(), "rc.1");
+	BOOST_CHECK_EQUAL(s.predecessor(Semver200_version("3.0.0"))->minor(), 4);
+	BOOST_CHECK(s.predecessor(p.parse("1.0.0")) == s.end());
+}
+
+// range queries respect prerelease admission
+BOOST_AUTO_TEST_CASE(set_range_queries) {
+	const vector<string> src = { "1.0.0", "1.2.0", "1.9.0", "2.0.0-rc.1", "2.0.0", "2.1.0-beta", "2.4.1", "3.0.0" };
+	const Version_set s(src.begin(), src.end());
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range("<3.0.0"))->minor(), 4);
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range("^1.0.0"))->minor(), 9);
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range(">=2.1.0-alpha <2.2.0"))->prerelease(), "beta");
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range("<2.1.0"))->major(), 2);
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range("^1.0.0 || ^2.0.0"))->minor(), 4);
+	BOOST_CHECK(s.max_satisfying(Semver200_range("^4.0.0")) == s.end());
+	BOOST_CHECK(s.max_satisfying(Semver200_range(">2.0.0 <2.2.0")) == s.end());
+	BOOST_CHECK_EQUAL(s.max_satisfying(Semver200_range(">2.0.0 <2.2.0", true))->prerelease(), "beta");
+
+	auto all = s.satisfying(Semver200_range("1.x || >=1.2.0 <2.1.0 || ^2.4.0"));
+	BOOST_REQUIRE_EQUAL(all.size(), 5u);
+	BOOST_CHECK_EQUAL(all[0].minor(), 0);
+	BOOST_CHECK_EQUAL(all[2].minor(), 9);
+	BOOST_CHECK_EQUAL(all[3].major(), 2);
+	BOOST_CHECK(all[3].prerelease().empty());
+	BOOST_CHECK_EQUAL(all[4].minor(), 4);
+	BOOST_CHECK(s.satisfying(Semver200_range(">*")).empty());
+}
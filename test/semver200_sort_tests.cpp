@@ -0,0 +1,108 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_sort_tests
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_sort.h"
+
+using namespace version;
+using namespace std;
+
+namespace {
+	vector<string> make_versions(const size_t n) {
+		const vector<string> pre = { "", "-alpha", "-alpha.1", "-rc.2", "-rc.10", "-0", "-beta.x.1" };
+		vector<string> out;
+		for (size_t i = 0; i < n; ++i) {
+			size_t h = i * 2654435761u;
+			out.push_back(to_string(h % 3 * 300) + "." + to_string(h / 3 % 5) + "." + to_string(h / 15 % 4)
+				+ pre[h / 60 % pre.size()] + "+b" + to_string(i));
+		}
+		return out;
+	}
+
+	bool same_order(const vector<Semver200_version>& a, const vector<Semver200_version>& b) {
+		if (a.size() != b.size()) return false;
+		for (size_t i = 0; i < a.size(); ++i) {
+			if (a[i].build() != b[i].build()) return false;
+		}
+		return true;
+	}
+}
+
+// radix sort agrees with stable comparison sort
+BOOST_AUTO_TEST_CASE(sort_matches_stable_sort) {
+	for (const size_t n : { 0u, 1u, 2u, 50u, 1000u, 20000u }) {
+		const auto src = make_versions(n);
+		vector<Semver200_version> expected(src.begin(), src.end());
+		stable_sort(expected.begin(), expected.end());
+
+		for (const unsigned threads : { 1u, 4u }) {
+			vector<Semver200_version> v(src.begin(), src.end());
+			Sort_options o;
+			o.threads = threads;
+			o.stable = true;
+			sort_versions(v, o);
+			BOOST_CHECK(same_order(v, expected));
+
+			vector<Semver200_version> u(src.begin(), src.end());
+			o.stable = false;
+			sort_versions(u, o);
+			BOOST_CHECK(is_sorted(u.begin(), u.end()));
+		}
+	}
+}
+
+// version data can be sorted directly
+BOOST_AUTO_TEST_CASE(sort_version_data) {
+	vector<Version_data> v;
+	for (const auto& s : { "2.0.0", "1.0.0-rc.10", "10.0.0", "1.0.0-rc.9", "1.0.0", "0.0.1+z", "0.0.1+a" }) {
+		v.push_back(p.parse(s));
+	}
+	Sort_options o;
+	o.threads = 0;
+	o.stable = true;
+	sort_versions(v, o);
+	BOOST_CHECK_EQUAL(v[0].build_ids[0], "z");
+	BOOST_CHECK_EQUAL(v[1].build_ids[0], "a");
+	BOOST_CHECK_EQUAL(v[2].prerelease_ids[1].first, "9");
+	BOOST_CHECK_EQUAL(v[3].prerelease_ids[1].first, "10");
+	BOOST_CHECK(v[4].prerelease_ids.empty());
+	BOOST_CHECK_EQUAL(v[5].major, 2);
+	BOOST_CHECK_EQUAL(v[6].major, 10);
+}
+
+// large components sort numerically
+BOOST_AUTO_TEST_CASE(sort_large_components) {
+	vector<Semver200_version> v = { Semver200_version("2147483647.0.0"), Semver200_version("256.0.0"),
+		Semver200_version("1.2147483647.2147483647"), Semver200_version("1.2147483647.2147483647-x"),
+		Semver200_version("255.255.255") };
+	sort_versions(v);
+	BOOST_CHECK(is_sorted(v.begin(), v.end()));
+	BOOST_CHECK_EQUAL(v[0].prerelease(), "x");
+	BOOST_CHECK_EQUAL(v[4].major(), 2147483647);
+}
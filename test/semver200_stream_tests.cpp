@@ -0,0 +1,165 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_stream_tests
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "semver200_parser_util.h"
+#include "semver200_stream.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <thread>
+#include <sys/stat.h>
+#endif
+
+using namespace version;
+using namespace std;
+
+namespace {
+	/// Visitor recording everything it receives as text.
+	struct Collector : Record_visitor {
+		void version(const Version_view& v, const size_t line) override {
+			ostringstream os;
+			os << line << ":" << v.major << "." << v.minor << "." << v.patch;
+			if (!v.prerelease.empty()) os << "-" << v.prerelease.str();
+			if (!v.build.empty()) os << "+" << v.build.str();
+			out.push_back(os.str());
+		}
+
+		void error(const Record_error& e) override {
+			ostringstream os;
+			os << line_prefix(e) << e.text.str() << (e.too_long ? " too long" : "")
+				<< " @" << e.status.offset;
+			out.push_back(os.str());
+		}
+
+		static string line_prefix(const Record_error& e) {
+			return "!" + to_string(e.line) + "+" + to_string(e.offset) + ":";
+		}
+
+		vector<string> out;
+	};
+
+	vector<string> feed_split(const string& s, const size_t split, const char delimiter = '\n',
+		const size_t max = Semver200_stream_parser::default_max_record_size) {
+		Collector c;
+		Semver200_stream_parser p(c, delimiter, max);
+		for (size_t i = 0; i < s.size(); i += split) p.feed(s.data() + i, min(split, s.size() - i));
+		p.finish();
+		return c.out;
+	}
+}
+
+// records are reported with line numbers, errors with line, stream offset and error position
+BOOST_AUTO_TEST_CASE(stream_records) {
+	const string s = "1.2.3\n\n1.0.0-rc.1+b\r\n01.2.3\n2.0.0";
+	const vector<string> expected = { "1:1.2.3", "3:1.0.0-rc.1+b", "!4+21:01.2.3 @1", "5:2.0.0" };
+	BOOST_CHECK(feed_split(s, s.size()) == expected);
+	// splitting into chunks at any position gives same result
+	for (size_t split = 1; split < s.size(); ++split) {
+		BOOST_CHECK(feed_split(s, split) == expected);
+	}
+}
+
+// final chunk is parsed in place unless a record is pending
+BOOST_AUTO_TEST_CASE(stream_feed_final) {
+	Collector c;
+	Semver200_stream_parser p(c);
+	const string s = "1.2.3\nx";
+	p.feed_final(s.data(), s.size());
+	BOOST_CHECK(c.out == vector<string>({ "1:1.2.3", "!2+6:x @0" }));
+
+	p.feed("4.", 2);
+	p.feed_final("5.6\n7", 5);
+	BOOST_CHECK_EQUAL(c.out[2], "3:4.5.6");
+	BOOST_CHECK_EQUAL(c.out[3], "!4+13:7 @1");
+}
+
+// NUL-delimited streams do not strip carriage returns
+BOOST_AUTO_TEST_CASE(stream_nul) {
+	const string s("1.2.3\0" "4.5.6\r\0", 13);
+	const vector<string> expected = { "1:1.2.3", "!2+6:4.5.6\r @5" };
+	for (size_t split = 1; split <= s.size(); ++split) {
+		BOOST_CHECK(feed_split(s, split, '\0') == expected);
+	}
+}
+
+// records longer than the buffer are reported without being parsed, whether split or not
+BOOST_AUTO_TEST_CASE(stream_too_long) {
+	const string s = "1.2.3\n1.2.3-aaaaaaaaaaaa\n3.0.0";
+	for (size_t split = 1; split <= s.size(); ++split) {
+		BOOST_CHECK(feed_split(s, split, '\n', 8) == vector<string>({ "1:1.2.3", "!2+6:1.2.3-aa too long @0", "3:3.0.0" }));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(stream_file) {
+	const string path = "semver200_stream_tests.tmp";
+	{
+		ofstream os(path, ios::binary);
+		for (int i = 0; i < 100000; ++i) os << "1." << i << ".0" << (i % 1000 == 0 ? "-" : "") << "\n";
+	}
+	Collector c;
+	parse_version_file(path, c);
+	remove(path.c_str());
+	BOOST_REQUIRE_EQUAL(c.out.size(), 100000);
+	BOOST_CHECK_EQUAL(c.out[1], "2:1.1.0");
+	BOOST_CHECK_EQUAL(c.out[1000], "!1001+7891:1.1000.0- @9");
+	BOOST_CHECK_EQUAL(c.out[99999], "100000:1.99999.0");
+
+	BOOST_CHECK_THROW(parse_version_file(path, c), system_error);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// files without a meaningful size, like FIFOs, are read rather than mapped
+BOOST_AUTO_TEST_CASE(stream_fifo) {
+	const string path = "semver200_stream_tests.fifo";
+	remove(path.c_str());
+	BOOST_REQUIRE_EQUAL(mkfifo(path.c_str(), 0600), 0);
+	thread writer([&]() {
+		ofstream os(path, ios::binary);
+		for (int i = 0; i < 20000; ++i) os << "2." << i << ".0\n";
+		os << "x";
+	});
+	Collector c;
+	parse_version_file(path, c);
+	writer.join();
+	remove(path.c_str());
+	BOOST_REQUIRE_EQUAL(c.out.size(), 20001);
+	BOOST_CHECK_EQUAL(c.out[0], "1:2.0.0");
+	BOOST_CHECK_EQUAL(c.out[19999], "20000:2.19999.0");
+	BOOST_CHECK_EQUAL(c.out[20000], "!20001+188890:x @0");
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(stream_istream) {
+	istringstream is("1.2.3\nx\n4.5.6");
+	Collector c;
+	parse_version_stream(is, c);
+	BOOST_CHECK(c.out == vector<string>({ "1:1.2.3", "!2+6:x @0", "3:4.5.6" }));
+}
@@ -24,6 +24,11 @@ SOFTWARE.
 
 #define BOOST_TEST_MODULE semver200_version_tests
 
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include "semver200.h"
 
@@ -75,4 +80,55 @@ BOOST_AUTO_TEST_CASE(test_accessors) {
 	BOOST_CHECK_EQUAL(p.patch(), 3);
 	BOOST_CHECK_EQUAL(p.prerelease(), "pre.rel.1");
 	BOOST_CHECK_EQUAL(p.build(), "test.build.321");
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(test_move) {
+	static_assert(std::is_nothrow_move_constructible<v>::value, "versions should be cheap to move");
+	static_assert(std::is_nothrow_move_assignable<v>::value, "versions should be cheap to move");
+
+	v a("1.2.3-alpha.1+build.5");
+	v b(std::move(a));
+	BOOST_CHECK_EQUAL(b.prerelease(), "alpha.1");
+	BOOST_CHECK_EQUAL(b.build(), "build.5");
+
+	v c;
+	c = std::move(b);
+	BOOST_CHECK(c == v("1.2.3-alpha.1"));
+	BOOST_CHECK_EQUAL(c.build(), "build.5");
+
+	// Moved-from version can be assigned to again
+	b = v("2.0.0");
+	BOOST_CHECK_EQUAL(b.major(), 2);
+
+	std::vector<v> vs;
+	for (int i = 0; i < 100; ++i) vs.emplace_back("1.0.0-rc." + std::to_string(i));
+	BOOST_CHECK_EQUAL(vs[99].prerelease(), "rc.99");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_chars) {
+	for (const std::string s : { "0.0.0", "1.2.3", "10.200.3000-alpha.1", "1.0.0+build.5",
+		"2147483647.2147483647.2147483647-x.7.z.92+exp.sha.5114f85" }) {
+		const v ver(s);
+		BOOST_CHECK_EQUAL(ver.formatted_size(), s.size());
+
+		char buf[80];
+		BOOST_REQUIRE_EQUAL(ver.to_chars(buf, sizeof(buf)), s.size());
+		BOOST_CHECK_EQUAL(std::string(buf, s.size()), s);
+
+		// Too small buffer is left untouched
+		char small[4] = { 'a', 'b', 'c', 'd' };
+		if (s.size() > sizeof(small)) {
+			BOOST_CHECK_EQUAL(ver.to_chars(small, sizeof(small)), s.size());
+			BOOST_CHECK_EQUAL(std::string(small, sizeof(small)), "abcd");
+		}
+	}
+
+	// Hand-made data is formatted as is
+	const Version_data d{ -1, 0, 12, Prerelease_identifiers{ { "rc", Id_type::alnum } }, Build_identifiers{ "a", "b" } };
+	char buf[32];
+	BOOST_REQUIRE_EQUAL(to_chars(buf, sizeof(buf), d), formatted_size(d));
+	BOOST_CHECK_EQUAL(std::string(buf, formatted_size(d)), "-1.0.12-rc+a.b");
+
+	// Versions longer than the stream buffer are printed in full
+	const std::string long_build = "1.0.0+" + std::string(200, 'x');
+	CHECK_RT(long_build);
+}
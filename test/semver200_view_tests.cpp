@@ -0,0 +1,111 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2015 Marko Zivanovic
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define BOOST_TEST_MODULE semver200_view_tests
+
+#include <string>
+#include "semver200_parser_util.h"
+
+using namespace version;
+using namespace std;
+
+Semver200_comparator c;
+
+inline Version_view view(const string& s) {
+	return p.parse_view(s.data(), s.size());
+}
+
+inline int compare_views(const string& l, const string& r) {
+	return c.compare(view(l), view(r));
+}
+
+inline int compare_data(const string& l, const string& r) {
+	return c.compare(p.parse(l), p.parse(r));
+}
+
+// views reference prerelease and build text of source buffer
+BOOST_AUTO_TEST_CASE(parse_view_components) {
+	const string s = "1.2.3-alpha.1+build.314";
+	auto v = p.parse_view(s.data(), s.size());
+	BOOST_CHECK_EQUAL(v.major, 1);
+	BOOST_CHECK_EQUAL(v.minor, 2);
+	BOOST_CHECK_EQUAL(v.patch, 3);
+	BOOST_CHECK(v.prerelease.data == s.data() + 6);
+	BOOST_CHECK_EQUAL(v.prerelease.str(), "alpha.1");
+	BOOST_CHECK(v.build.data == s.data() + 14);
+	BOOST_CHECK_EQUAL(v.build.str(), "build.314");
+
+	auto n = view("1.2.3");
+	BOOST_CHECK(n.prerelease.empty());
+	BOOST_CHECK(n.build.empty());
+}
+
+// ranges of a larger buffer can be parsed without copying
+BOOST_AUTO_TEST_CASE(parse_slice) {
+	const string buffer = "pkg@1.2.3-rc.1,other@4.5.6";
+	auto v = p.parse_view(buffer.data() + 4, 10);
+	BOOST_CHECK_EQUAL(v.prerelease.str(), "rc.1");
+	auto d = p.parse(buffer.data() + 21, 5);
+	BOOST_CHECK_EQUAL(d.major, 4);
+	BOOST_CHECK_EQUAL(d.patch, 6);
+	BOOST_CHECK_THROW(p.parse_view(buffer.data(), 14), Parse_error);
+	BOOST_CHECK_THROW(p.parse(buffer.data() + 4, 11), Parse_error);
+}
+
+// identifier iteration yields the same identifiers as full parse
+BOOST_AUTO_TEST_CASE(view_identifiers) {
+	const string s = "1.2.3-1.a.22.bb-0.0+b.1.x-y";
+	auto v = view(s);
+	BOOST_CHECK_EQUAL(v.to_data().prerelease_ids, p.parse(s).prerelease_ids);
+	BOOST_CHECK_EQUAL(v.to_data().build_ids, p.parse(s).build_ids);
+
+	size_t count = 0;
+	for (const auto& id : v.prerelease_ids()) {
+		BOOST_CHECK(id.type == p.parse(s).prerelease_ids[count].second);
+		++count;
+	}
+	BOOST_CHECK_EQUAL(count, 5u);
+}
+
+// view comparison follows semver 2.0.0 precedence rules
+BOOST_AUTO_TEST_CASE(compare_views_precedence) {
+	const vector<string> ordered = { "0.9.9", "1.0.0-0", "1.0.0-1", "1.0.0-2", "1.0.0-10", "1.0.0-alpha",
+		"1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta", "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1",
+		"1.0.0-rc.1.0", "1.0.0", "1.0.1", "1.1.0", "2.0.0" };
+	for (size_t i = 0; i < ordered.size(); ++i) {
+		for (size_t j = 0; j < ordered.size(); ++j) {
+			BOOST_CHECK_EQUAL(compare_views(ordered[i], ordered[j]), compare_data(ordered[i], ordered[j]));
+		}
+	}
+	BOOST_CHECK_EQUAL(compare_views("1.0.0+a", "1.0.0+b"), 0);
+	BOOST_CHECK_EQUAL(compare_views("1.0.0-99999999999999999999", "1.0.0-100000000000000000000"), -1);
+}
+
+// versions can be constructed from character ranges
+BOOST_AUTO_TEST_CASE(version_from_range) {
+	const string buffer = "[1.2.3-x]";
+	Semver200_version v(buffer.data() + 1, 7);
+	BOOST_CHECK_EQUAL(v.prerelease(), "x");
+	BOOST_CHECK(v == Semver200_version("1.2.3-x"));
+}